@@ -48,361 +48,16 @@ AUX audio select:
 #include <Wire.h>
 #include <Preferences.h>
 #include <CarComms.h>
+#include <CarScheduler.h>
+#include "Screens.h"  // Generated from the D_*.png files, see the header
 
-// 'D_Aux', 128x64px
-const unsigned char bmp_D_Aux[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x0f, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x3f, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x03,
-    0xc0, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x03,
-    0xe0, 0xfb, 0x81, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0xc0, 0x01,
-    0xf0, 0xf3, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x07, 0x00, 0x00, 0xe0, 0x01, 0xe0, 0x01,
-    0xf0, 0xe3, 0x83, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf7, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x60, 0x00,
-    0xf8, 0xc3, 0x87, 0x07, 0x00, 0x00, 0x00, 0xc0, 0xef, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x07, 0x07,
-    0xb8, 0x93, 0x87, 0x07, 0x00, 0x00, 0x00, 0xe0, 0xdf, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0xff, 0x1f,
-    0x3c, 0x13, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0xe1, 0xff, 0x3f,
-    0x7c, 0x82, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x1f,
-    0xfc, 0xc0, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xfc, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x0f,
-    0xfc, 0xe1, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x0f,
-    0xfc, 0xf3, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x07,
-    0xfc, 0xe1, 0x8f, 0x07, 0x00, 0x00, 0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x0f,
-    0xfc, 0xc0, 0x8f, 0x07, 0x00, 0x00, 0xc0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x0f,
-    0x7c, 0x92, 0x8f, 0x07, 0x00, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x0f,
-    0x3c, 0x13, 0x8f, 0x07, 0x00, 0x00, 0xf0, 0xff, 0x07, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x1f,
-    0xb8, 0x83, 0x87, 0x07, 0x00, 0x00, 0xf8, 0xff, 0x03, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x7f,
-    0xf8, 0xc3, 0x87, 0x07, 0x00, 0x00, 0xfc, 0xff, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xe1, 0xff, 0x3f,
-    0xf0, 0xe3, 0x83, 0x07, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe1, 0xff, 0x3f,
-    0xf0, 0xf3, 0x83, 0x07, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0xff, 0x1f,
-    0xe0, 0xfb, 0x81, 0x07, 0x00, 0x80, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x81, 0xff, 0x0f,
-    0xc0, 0xff, 0x80, 0x07, 0x00, 0xc0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x81, 0xff, 0x0f,
-    0x00, 0x3f, 0x80, 0x07, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x8e, 0x03,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xe0, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xf0, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xf0, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xf0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xd8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xbc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x7e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xc0, 0x00, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x03,
-    0x24, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x24,
-    0x14, 0x00, 0x88, 0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 0x11, 0x00, 0x28,
-    0x0c, 0x3c, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x3c, 0x30,
-    0x3c, 0xc3, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0xc3, 0x3c,
-    0x80, 0x3c, 0x91, 0x07, 0x00, 0x10, 0x42, 0x21, 0x3c, 0x00, 0x08, 0x00, 0xe0, 0x89, 0x3c, 0x01,
-    0x80, 0x7e, 0x91, 0x07, 0x00, 0x28, 0x42, 0x12, 0x44, 0x00, 0x08, 0x00, 0xe0, 0x89, 0x7e, 0x01,
-    0x40, 0xff, 0x92, 0x07, 0x00, 0x28, 0x42, 0x12, 0x44, 0x4e, 0x1d, 0x00, 0xe0, 0x49, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x28, 0x42, 0x0c, 0x44, 0xd1, 0x08, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x44, 0x42, 0x0c, 0x3c, 0x51, 0x08, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x7c, 0x42, 0x12, 0x04, 0x51, 0x08, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x80, 0x7e, 0x81, 0x07, 0x00, 0x82, 0x42, 0x12, 0x04, 0x51, 0x08, 0x00, 0xe0, 0x81, 0x7e, 0x01,
-    0x80, 0x3c, 0x81, 0x07, 0x00, 0x82, 0x3c, 0x21, 0x04, 0x4e, 0x18, 0x00, 0xe0, 0x81, 0x3c, 0x01,
-    0x00, 0xc3, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc3, 0x00,
-    0x00, 0x3c, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x3c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00
-};
-// 'D_Bluetooth', 128x64px
-const unsigned char bmp_D_Bluetooth[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x07, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf8, 0x7f, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfc, 0x7f, 0xfe, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0x7f, 0xfc, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0x7f, 0xf8, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xc0, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0x80, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x15, 0x80, 0x07, 0x00, 0x00, 0x7f, 0x7f, 0x04, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x15, 0x80, 0x07, 0x00, 0x00, 0x3f, 0x7e, 0x0c, 0xfe, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x70,
-    0x80, 0x3f, 0x80, 0x07, 0x00, 0x80, 0x3f, 0x7c, 0x1c, 0xfc, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x78,
-    0xe0, 0xff, 0x80, 0x07, 0x00, 0x80, 0x7f, 0x78, 0x1c, 0xfc, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x74,
-    0x80, 0x31, 0x80, 0x07, 0x00, 0x80, 0xff, 0x70, 0x0c, 0xfe, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x2e,
-    0xe0, 0xf1, 0x80, 0x07, 0x00, 0x80, 0xff, 0x61, 0x04, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x1d,
-    0x80, 0x31, 0x80, 0x07, 0x00, 0x80, 0xff, 0x43, 0x80, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x80, 0x0b,
-    0xe0, 0xff, 0x80, 0x07, 0x00, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0x01, 0xc0, 0x07,
-    0x80, 0x3f, 0x80, 0x07, 0x00, 0x80, 0xff, 0x0f, 0xe0, 0xff, 0x03, 0x00, 0xe0, 0x01, 0xe0, 0x03,
-    0x00, 0x15, 0x80, 0x07, 0x00, 0x80, 0xff, 0x1f, 0xf0, 0xff, 0x03, 0x00, 0xe0, 0x01, 0xc8, 0x01,
-    0x00, 0x15, 0x80, 0x07, 0x00, 0x80, 0xff, 0x3f, 0xf8, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x9c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0xff, 0x3f, 0xf8, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x3e, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0xff, 0x1f, 0xf0, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x7f, 0x00,
-    0xc0, 0x3f, 0x80, 0x07, 0x00, 0x80, 0xff, 0x0f, 0xe0, 0xff, 0x03, 0x00, 0xe0, 0x81, 0x3f, 0x00,
-    0xe0, 0x7f, 0x80, 0x07, 0x00, 0x80, 0xff, 0x07, 0xc0, 0xff, 0x03, 0x00, 0xe0, 0xc1, 0x1f, 0x00,
-    0xf0, 0xff, 0x80, 0x07, 0x00, 0x80, 0xff, 0x43, 0x80, 0xff, 0x03, 0x00, 0xe0, 0xc1, 0x0f, 0x00,
-    0xfc, 0xff, 0x8f, 0x07, 0x00, 0x80, 0xff, 0x61, 0x04, 0xff, 0x03, 0x00, 0xe0, 0xc1, 0x07, 0x00,
-    0x8c, 0x7f, 0x8c, 0x07, 0x00, 0x80, 0xff, 0x70, 0x0c, 0xfe, 0x03, 0x00, 0xe0, 0x81, 0x03, 0x00,
-    0x74, 0xbf, 0x8b, 0x07, 0x00, 0x80, 0x7f, 0x78, 0x1c, 0xfc, 0x03, 0x00, 0xe0, 0x31, 0x00, 0x00,
-    0x70, 0x80, 0x83, 0x07, 0x00, 0x80, 0x3f, 0x7c, 0x1c, 0xfc, 0x03, 0x00, 0xe0, 0x39, 0x00, 0x00,
-    0x70, 0x80, 0x83, 0x07, 0x00, 0x00, 0x3f, 0x7e, 0x0c, 0xfe, 0x01, 0x00, 0xe0, 0x19, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x7f, 0x7f, 0x04, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0x80, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xc0, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xe0, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0x7f, 0xf0, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0x7f, 0xf8, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0x7f, 0xfc, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfc, 0x7f, 0xfe, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf8, 0x7f, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xc0, 0x00, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x03,
-    0x24, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x24,
-    0x14, 0x00, 0x88, 0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 0x11, 0x00, 0x28,
-    0x0c, 0x3c, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x3c, 0x30,
-    0x3c, 0xc3, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0xc3, 0x3c,
-    0x80, 0x3c, 0x91, 0x07, 0x00, 0x3e, 0x01, 0x80, 0x00, 0x40, 0x01, 0x00, 0xe0, 0x89, 0x3c, 0x01,
-    0x80, 0x7e, 0x91, 0x07, 0x00, 0x42, 0x01, 0x80, 0x00, 0x40, 0x01, 0x00, 0xe0, 0x89, 0x7e, 0x01,
-    0x40, 0xff, 0x92, 0x07, 0x00, 0x42, 0x45, 0xce, 0x1d, 0xe7, 0x0d, 0x00, 0xe0, 0x49, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x7e, 0x45, 0x91, 0xa2, 0x48, 0x13, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x42, 0x45, 0x9f, 0xa2, 0x48, 0x11, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x42, 0x45, 0x81, 0xa2, 0x48, 0x11, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x80, 0x7e, 0x81, 0x07, 0x00, 0x42, 0x65, 0x91, 0xa2, 0x48, 0x11, 0x00, 0xe0, 0x81, 0x7e, 0x01,
-    0x80, 0x3c, 0x81, 0x07, 0x00, 0x3e, 0x59, 0x8e, 0x1d, 0xc7, 0x11, 0x00, 0xe0, 0x81, 0x3c, 0x01,
-    0x00, 0xc3, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc3, 0x00,
-    0x00, 0x3c, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x3c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00
-};
-// 'D_Carputer', 128x64px
-const unsigned char bmp_D_Carputer[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xf0, 0xff, 0x57, 0xfd, 0x07, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x08, 0x80, 0x07, 0x00, 0xf0, 0xff, 0x57, 0xfd, 0x07, 0x00, 0x00, 0xe0, 0x01, 0xfc, 0x00,
-    0x00, 0x1c, 0x80, 0x07, 0x00, 0xf8, 0xff, 0x57, 0xfd, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x03,
-    0x00, 0x1c, 0x80, 0x07, 0x00, 0xfc, 0xff, 0x00, 0xe0, 0x1f, 0x00, 0x00, 0xe0, 0x81, 0xef, 0x07,
-    0x00, 0x3e, 0x80, 0x07, 0x00, 0xfc, 0xff, 0x00, 0xe0, 0x3f, 0x00, 0x00, 0xe0, 0xc1, 0xcf, 0x0f,
-    0x00, 0x08, 0x80, 0x07, 0x00, 0xfe, 0xff, 0x00, 0xe0, 0x7f, 0x00, 0x00, 0xe0, 0xc1, 0x8f, 0x0f,
-    0x00, 0x08, 0x80, 0x07, 0x00, 0xff, 0x1f, 0xf8, 0x03, 0xff, 0x00, 0x00, 0xe0, 0xe1, 0x0f, 0x1f,
-    0x00, 0xc8, 0x81, 0x07, 0x80, 0xff, 0xff, 0xf8, 0xe3, 0xff, 0x01, 0x00, 0xe0, 0xe1, 0x4e, 0x1e,
-    0x00, 0xc8, 0x81, 0x07, 0xc0, 0xff, 0x1f, 0xf8, 0x03, 0xff, 0x07, 0x00, 0xe0, 0xf1, 0x4c, 0x3c,
-    0x80, 0xc8, 0x81, 0x07, 0xf8, 0xff, 0xff, 0xf8, 0xe3, 0xff, 0xff, 0x03, 0xe0, 0xf1, 0x09, 0x3e,
-    0xc0, 0x89, 0x80, 0x87, 0xff, 0xff, 0x1f, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xe0, 0xf1, 0x03, 0x3f,
-    0xc0, 0x89, 0x80, 0xe7, 0xff, 0xff, 0xff, 0xf8, 0xe3, 0xff, 0xff, 0xff, 0xe7, 0xf1, 0x87, 0x3f,
-    0x80, 0x48, 0x80, 0xe7, 0xff, 0xff, 0x1f, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xe7, 0xf1, 0xcf, 0x3f,
-    0x80, 0x28, 0x80, 0xe7, 0xff, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xf1, 0x87, 0x3f,
-    0x80, 0x19, 0x80, 0xe7, 0xff, 0xff, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xe7, 0xf1, 0x03, 0x3f,
-    0x00, 0x0b, 0x80, 0xe7, 0x7f, 0x80, 0xff, 0x00, 0xe0, 0xff, 0x03, 0xfc, 0xe7, 0xf1, 0x49, 0x3e,
-    0x00, 0x0e, 0x80, 0xe7, 0x1f, 0x00, 0xfe, 0x57, 0xfd, 0xff, 0x00, 0xf8, 0xe7, 0xf1, 0x4c, 0x3c,
-    0x00, 0x08, 0x80, 0xe7, 0x0f, 0x00, 0xfc, 0x57, 0xfd, 0x7f, 0x00, 0xf0, 0xe7, 0xe1, 0x0e, 0x1e,
-    0x00, 0x08, 0x80, 0xe7, 0x07, 0x1e, 0xf8, 0x57, 0xfd, 0x3f, 0xf0, 0xe0, 0xe7, 0xe1, 0x0f, 0x1f,
-    0x00, 0x08, 0x80, 0xe7, 0x83, 0x7f, 0xf8, 0xff, 0xff, 0x1f, 0xfc, 0xc3, 0xe7, 0xc1, 0x8f, 0x0f,
-    0x00, 0x18, 0x80, 0xe7, 0xc3, 0xff, 0xf0, 0xff, 0xff, 0x1f, 0xfe, 0xc7, 0xe7, 0xc1, 0xcf, 0x0f,
-    0x00, 0x3c, 0x80, 0xe7, 0xc3, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xfe, 0x87, 0xe7, 0x81, 0xef, 0x07,
-    0x00, 0x3c, 0x80, 0x07, 0xe0, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xe0, 0x01, 0xff, 0x03,
-    0x00, 0x18, 0x80, 0x07, 0xe0, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xe0, 0x01, 0xfc, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0xe0, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0xe0, 0xff, 0x01, 0x00, 0x00, 0x00, 0xff, 0x0f, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x07, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x07, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x80, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xc0, 0x00, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x03,
-    0x24, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x24,
-    0x14, 0x00, 0x88, 0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 0x11, 0x00, 0x28,
-    0x0c, 0x3c, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x3c, 0x30,
-    0x3c, 0xc3, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0xc3, 0x3c,
-    0x80, 0x3c, 0x91, 0x07, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe0, 0x89, 0x3c, 0x01,
-    0x80, 0x7e, 0x91, 0x07, 0x00, 0x10, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0xe0, 0x89, 0x7e, 0x01,
-    0x40, 0xff, 0x92, 0x07, 0x00, 0x08, 0x38, 0xd5, 0x44, 0x77, 0x0a, 0x00, 0xe0, 0x49, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0x44, 0x33, 0x45, 0x8a, 0x06, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0x78, 0x11, 0x45, 0xfa, 0x02, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0x44, 0x11, 0x45, 0x0a, 0x02, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x80, 0x7e, 0x81, 0x07, 0x00, 0x10, 0x65, 0x31, 0x65, 0x8a, 0x02, 0x00, 0xe0, 0x81, 0x7e, 0x01,
-    0x80, 0x3c, 0x81, 0x07, 0x00, 0xe0, 0x58, 0xd1, 0x58, 0x76, 0x02, 0x00, 0xe0, 0x81, 0x3c, 0x01,
-    0x00, 0xc3, 0x80, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc3, 0x00,
-    0x00, 0x3c, 0x80, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x3c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00
-};
-// 'D_Lightning', 128x64px
-const unsigned char bmp_D_Lightning[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xe0, 0x07, 0xe0, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf8, 0x3f, 0xfc, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x38, 0x00,
-    0x00, 0x00, 0x9c, 0x07, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x38, 0x00,
-    0x00, 0x00, 0x9e, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x7c, 0x00,
-    0x00, 0x00, 0x9d, 0x07, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0x00, 0x80, 0x8b, 0x07, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0x00, 0x40, 0x87, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x90, 0x03,
-    0x00, 0xe0, 0x82, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x90, 0x03,
-    0x00, 0xf0, 0x81, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x91, 0x03,
-    0x00, 0xf8, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x81, 0x13, 0x01,
-    0x00, 0x72, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x81, 0x13, 0x01,
-    0x00, 0x27, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x91, 0x00,
-    0x80, 0x0f, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0x51, 0x00,
-    0xc0, 0x1f, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xe0, 0x01, 0x33, 0x00,
-    0xe0, 0x0f, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x16, 0x00,
-    0xf0, 0x07, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x1c, 0x00,
-    0xf0, 0x03, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0xf0, 0x01, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0xe0, 0x00, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x10, 0x00,
-    0x0c, 0x00, 0x80, 0x07, 0x00, 0xe0, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x30, 0x00,
-    0x0e, 0x00, 0x80, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x78, 0x00,
-    0x06, 0x00, 0x80, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x78, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x07, 0x00, 0xe0, 0x01, 0x30, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0xc0, 0x1f, 0xf0, 0x07, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xc0, 0x00, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x03,
-    0x24, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x24,
-    0x14, 0x00, 0x88, 0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 0x11, 0x00, 0x28,
-    0x0c, 0x3c, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x3c, 0x30,
-    0x3c, 0xc3, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0xc3, 0x3c,
-    0x80, 0x3c, 0x91, 0x07, 0x00, 0x08, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00, 0xe0, 0x89, 0x3c, 0x01,
-    0x80, 0x7e, 0x91, 0x07, 0x00, 0x08, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x89, 0x7e, 0x01,
-    0x40, 0xff, 0x92, 0x07, 0x00, 0x08, 0xb2, 0x9a, 0x3f, 0x3d, 0x16, 0x00, 0xe0, 0x49, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0xca, 0x26, 0x45, 0x45, 0x19, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0x8a, 0x22, 0x45, 0x45, 0x11, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x08, 0x8a, 0x22, 0x45, 0x45, 0x11, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x80, 0x7e, 0x81, 0x07, 0x00, 0x08, 0xca, 0x22, 0x45, 0x45, 0x19, 0x00, 0xe0, 0x81, 0x7e, 0x01,
-    0x80, 0x3c, 0x81, 0x07, 0x00, 0xf8, 0xb2, 0x22, 0x47, 0x45, 0x16, 0x00, 0xe0, 0x81, 0x3c, 0x01,
-    0x00, 0xc3, 0x80, 0x07, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x10, 0x00, 0xe0, 0x01, 0xc3, 0x00,
-    0x00, 0x3c, 0x80, 0x07, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x0f, 0x00, 0xe0, 0x01, 0x3c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00
-};
-// 'D_USB', 128x64px
-const unsigned char bmp_D_USB[] PROGMEM = {
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xc0, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xf0, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x54, 0x00,
-    0x00, 0x70, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x01, 0x54, 0x00,
-    0x00, 0x78, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x01, 0xfe, 0x00,
-    0x00, 0x18, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x81, 0xff, 0x03,
-    0xc0, 0xc1, 0x81, 0x07, 0x00, 0x00, 0x00, 0x80, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x01, 0xc6, 0x00,
-    0xf0, 0xff, 0x87, 0x07, 0x00, 0x00, 0x80, 0x87, 0xf1, 0x03, 0x00, 0x00, 0xe0, 0x81, 0xc7, 0x03,
-    0xf8, 0xff, 0x8f, 0x07, 0x00, 0x00, 0xc0, 0x8f, 0xc1, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc6, 0x00,
-    0xfc, 0xff, 0x87, 0x07, 0x00, 0x00, 0xc0, 0x8f, 0xc1, 0x00, 0x00, 0x00, 0xe0, 0x81, 0xff, 0x03,
-    0xfc, 0xff, 0x83, 0x07, 0x00, 0x00, 0xc0, 0x8f, 0xc1, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xfe, 0x00,
-    0xfc, 0xff, 0x83, 0x07, 0x00, 0x00, 0xc0, 0x8f, 0xe1, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x54, 0x00,
-    0xfc, 0xff, 0x81, 0x07, 0x00, 0x00, 0x80, 0x87, 0x61, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x54, 0x00,
-    0xfc, 0xff, 0x83, 0x07, 0x00, 0x00, 0x00, 0x83, 0x71, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0xfc, 0xff, 0x83, 0x07, 0x00, 0x00, 0x00, 0x83, 0x39, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0xfc, 0xff, 0x83, 0x07, 0x00, 0x00, 0x00, 0x83, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xfc, 0xff, 0x87, 0x07, 0x00, 0x00, 0x00, 0x83, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x81, 0xff, 0x01,
-    0xfc, 0xff, 0x9f, 0x07, 0x00, 0x00, 0x00, 0x87, 0x03, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0xff, 0x03,
-    0xf8, 0xff, 0x8f, 0x07, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xf1, 0xff, 0x3f,
-    0xf8, 0xff, 0x8f, 0x07, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x31, 0xfe, 0x31,
-    0xf0, 0xff, 0x87, 0x07, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xd1, 0xfd, 0x2e,
-    0xe0, 0xff, 0x83, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x01, 0x0e,
-    0xe0, 0xff, 0x83, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x01, 0x0e,
-    0x80, 0xe3, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
-    0x00, 0xff, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xff, 0x00,
-    0xc0, 0x00, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xc1, 0x00, 0x03,
-    0x24, 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x21, 0x00, 0x24,
-    0x14, 0x00, 0x88, 0x07, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xe0, 0x11, 0x00, 0x28,
-    0x0c, 0x3c, 0x88, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x11, 0x3c, 0x30,
-    0x3c, 0xc3, 0x90, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x09, 0xc3, 0x3c,
-    0x80, 0x3c, 0x91, 0x07, 0x00, 0x00, 0x21, 0xcf, 0x07, 0x38, 0x00, 0x00, 0xe0, 0x89, 0x3c, 0x01,
-    0x80, 0x7e, 0x91, 0x07, 0x00, 0x00, 0xa1, 0x50, 0x08, 0x44, 0x00, 0x00, 0xe0, 0x89, 0x7e, 0x01,
-    0x40, 0xff, 0x92, 0x07, 0x00, 0x00, 0xa1, 0x40, 0x08, 0x02, 0x00, 0x00, 0xe0, 0x49, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x00, 0x21, 0xc3, 0x0f, 0x02, 0x00, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x00, 0x21, 0x4c, 0x08, 0x02, 0x00, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x40, 0xff, 0x82, 0x07, 0x00, 0x00, 0x21, 0x50, 0xe8, 0x02, 0x00, 0x00, 0xe0, 0x41, 0xff, 0x02,
-    0x80, 0x7e, 0x81, 0x07, 0x00, 0x00, 0xa1, 0x50, 0x08, 0x44, 0x00, 0x00, 0xe0, 0x81, 0x7e, 0x01,
-    0x80, 0x3c, 0x81, 0x07, 0x00, 0x00, 0x1e, 0xcf, 0x07, 0x38, 0x00, 0x00, 0xe0, 0x81, 0x3c, 0x01,
-    0x00, 0xc3, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc3, 0x00,
-    0x00, 0x3c, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x3c, 0x00,
-    0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00
-};
-
-
-
-
-
-
-
-
-
-
-
-
-
+// Screens are stored in the SSD1306 buffer layout, so a switch is just a copy
 const unsigned char* displays[5] = {
-    bmp_D_Bluetooth,
-    bmp_D_Aux,
-    bmp_D_Lightning,
-    bmp_D_USB,
-    bmp_D_Carputer
+    tiles_D_Bluetooth,
+    tiles_D_Aux,
+    tiles_D_Lightning,
+    tiles_D_USB,
+    tiles_D_Carputer
 };
 
 
@@ -411,6 +66,13 @@ const unsigned char* displays[5] = {
 
 #define CLICKS_PER_ROTATION 4  // The encoder outputs 4 times when rotated once
 
+#define SCREEN_WIDTH 128
+#define SCREEN_TILE_WIDTH (SCREEN_WIDTH / 8)
+
+#define SLIDE_MS 180  // Length of a slide between two screens
+#define FRAME_MS 30   // Frame budget, a full frame is ~27ms over 400kHz I2C
+#define SETTLE_MS 1000  // Save and publish the source once it hasn't changed for this long
+
 enum AudioSource : byte
 {
     Bluetooth,
@@ -421,11 +83,22 @@ enum AudioSource : byte
 };
 
 Rotary dial;
-U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE);
+// Shadow of the display RAM (1 KB): parts the screens share are not sent again
+U8G2_SHADOW<U8G2_SSD1306_128X64_NONAME_F_HW_I2C> u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE);
 Preferences preferences;
+CarScheduler scheduler;
+
+int audioSource = (int)Bluetooth;  // Selected source, the screen catches up through slides
 
-bool sourceChanged = true;  // Start true so we get an inital screen update
-int audioSource = (int)Bluetooth;
+// Slide state. The position is computed from the time, so when the display
+// can't keep up frames are dropped instead of the slide getting slower.
+int shownSource = (int)Bluetooth;  // Screen at the end of the current slide
+int slideFrom;
+int8_t slideDir = 0;  // 1: next screen comes in from the right, -1: from the left, 0: no slide running
+int8_t lastRotation = 1;
+uint32_t slideStartMS;
+
+TaskHandle settleTask;
 
 const byte LAST_AUDIOSOURCE = Carputer;  // Used to loop back around
 
@@ -437,6 +110,7 @@ void setup()
     dial.begin(ROTARY_PIN1, ROTARY_PIN2, CLICKS_PER_ROTATION);
     dial.setLeftRotationHandler(rotateLeft);
     dial.setRightRotationHandler(rotateRight);
+    dial.attachInterrupts();  // Keep counting during sendBuffer() and preferences writes
 
     u8g2.begin();
 
@@ -447,40 +121,106 @@ void setup()
 
     comms.begin();
     comms.receiveTypeMask = CarDataType::ID_AUDIO_SOURCE;
+
+    // Initial screen, no slide
+    shownSource = audioSource;
+    drawScreen(audioSource);
+    u8g2.sendBuffer();
+    scheduler.setRenderHandler(render, nullptr, FRAME_MS);
+    broadcastSource();  // Already saved, no need to write the flash again
 }
 
 void loop()
 {
     dial.loop();
+    scheduler.loop();
+}
 
-    if (sourceChanged)
-    {
-        updateScreen();
+void handleCarData(CarDataType type, const uint8_t* data, int len)
+{
+}
 
-        // Save last used source
-        preferences.begin("audio-switcher", false);
-        preferences.putInt("lastSource", audioSource);
-        preferences.end();
+void drawScreen(int source)
+{
+    // Overwrites the whole buffer, no clearBuffer() needed
+    u8g2.drawTileImage(0, 0, u8g2.getBufferTileWidth(), u8g2.getBufferTileHeight(), displays[source]);
+}
 
-        sourceChanged = false;
+// "offset" columns of the new screen are visible
+void drawSlide(int from, int to, int8_t dir, int offset)
+{
+    uint8_t rows = u8g2.getBufferTileHeight();
+    if (dir > 0)
+    {
+        u8g2.drawTileImagePart(0, 0, SCREEN_WIDTH - offset, rows, displays[from], SCREEN_TILE_WIDTH, offset);
+        u8g2.drawTileImagePart(SCREEN_WIDTH - offset, 0, offset, rows, displays[to], SCREEN_TILE_WIDTH, 0);
+    }
+    else
+    {
+        u8g2.drawTileImagePart(0, 0, offset, rows, displays[to], SCREEN_TILE_WIDTH, SCREEN_WIDTH - offset);
+        u8g2.drawTileImagePart(offset, 0, SCREEN_WIDTH - offset, rows, displays[from], SCREEN_TILE_WIDTH, 0);
+    }
+}
+
+// Called by the scheduler at most once per FRAME_MS while a slide is running
+void render(void* arg)
+{
+    if (slideDir == 0)
+    {
+        if (audioSource == shownSource)
+            return;
+
+        // Slide straight to the latest selection, the sources passed on the way are skipped
+        slideFrom = shownSource;
+        shownSource = audioSource;
+        slideDir = lastRotation;
+        slideStartMS = millis();
+    }
 
-        AudioSourceMsg msg;
-        msg.audioSource = (uint8_t)audioSource;
-        comms.send(CarDataType::ID_AUDIO_SOURCE, &msg, sizeof(AudioSourceMsg));
+    uint32_t elapsed = millis() - slideStartMS;
+    if (elapsed >= SLIDE_MS)
+    {
+        drawScreen(shownSource);
+        slideDir = 0;
+        // The encoder moved on during the slide, start the next one
+        if (audioSource != shownSource)
+            scheduler.requestRender();
+    }
+    else
+    {
+        drawSlide(slideFrom, shownSource, slideDir, elapsed * SCREEN_WIDTH / SLIDE_MS);
+        scheduler.requestRender();
     }
+
+    u8g2.sendBuffer();  // transfer internal memory to the display
 }
 
-void handleCarData(CarDataType type, const uint8_t* data, int len)
+void broadcastSource()
 {
+    AudioSourceMsg msg;
+    msg.audioSource = (uint8_t)audioSource;
+    comms.send(CarDataType::ID_AUDIO_SOURCE, &msg, sizeof(AudioSourceMsg));
 }
 
-void updateScreen()
+// Runs once the encoder has been left alone for SETTLE_MS
+void publishSource(void* arg)
 {
-    u8g2.clearBuffer();  // clear the internal memory
-    //u8g2.setFont(u8g2_font_ncenB08_tr);   // choose a suitable font
-    //u8g2.drawStr(0, 10, "Hello World!");  // write something to the internal memory
-    u8g2.drawXBMP(0, 0, 128, 64, displays[audioSource]);
-    u8g2.sendBuffer();  // transfer internal memory to the display
+    // Save last used source
+    preferences.begin("audio-switcher", false);
+    preferences.putInt("lastSource", audioSource);
+    preferences.end();
+
+    broadcastSource();
+}
+
+void sourceChanged(int8_t dir)
+{
+    lastRotation = dir;
+    scheduler.requestRender();
+
+    // Every click pushes the save/publish back
+    scheduler.cancel(settleTask);
+    settleTask = scheduler.once(SETTLE_MS, publishSource);
 }
 
 void rotateLeft(Rotary& dial)
@@ -488,7 +228,7 @@ void rotateLeft(Rotary& dial)
     audioSource--;
     if (audioSource < 0)
         audioSource = LAST_AUDIOSOURCE;
-    sourceChanged = true;
+    sourceChanged(-1);
 }
 
 void rotateRight(Rotary& dial)
@@ -496,5 +236,5 @@ void rotateRight(Rotary& dial)
     audioSource++;
     if (audioSource > LAST_AUDIOSOURCE)
         audioSource = 0;
-    sourceChanged = true;
+    sourceChanged(1);
 }
@@ -8,11 +8,13 @@ This board will communicate via ESP-NOW and drive the display/settings
 #include <Wire.h>
 #include <LiquidCrystal_I2C.h>
 #include <CarComms.h>
+#include <CarScheduler.h>
 #include "Rotary.h"
 #include "Button2.h"
 
 LiquidCrystal_I2C lcd(0x27, 20, 4);
 CarComms comms(handleCarData);
+CarScheduler scheduler;
 
 #include "Icons.h"
 
@@ -57,12 +59,17 @@ enum : uint8_t
 #define MESSAGE_CONNECT_TIME 2000
 
 #define DISCONNECT_SET_UNCONNECTABLE_TIME 1000 // When we disconnect, make audio module unconnectable for this time
+#define CONNECT_AFTER_CONNECTABLE_TIME 250 // Then wait this long after turning it back on before connecting
+
+#define DISPLAY_FRAME_MS 50 // Bursts of track updates are drawn at most once per frame
+#define PENDING_MESSAGES 6 // ESP-NOW messages waiting for loop(), a devices broadcast and a few track updates
 
 #define ROTARY_PIN1 D3
 #define ROTARY_PIN2 D4
 #define ROTARY_BUTTON D5
 
 #define CLICKS_PER_ROTATION 4  // The encoder outputs 4 times when rotated once
+#define DIAL_MAX_ACCELERATION 4  // Spinning quickly moves through lists up to 4 options per detent
 
 #define SETTINGS_MAIN_DEVICE_LIST 0
 #define SETTINGS_MAIN_PAIR_DEVICE 1
@@ -79,12 +86,14 @@ enum : uint8_t
 
 State state;
 State nextState;
-long stateSwitchTimeMS;
+TaskHandle stateSwitchTask;
+TaskHandle idleSleepTask;
 bool switchingState;
 long lastStateSwitchTimeMS;
 
-bool waitingToSetConnectable;
-long disconnectTime;
+TaskHandle setConnectableTask;
+TaskHandle connectTask;
+uint8_t connectAddress[6];
 
 BTInfoMsg devices;
 BTInfoMsg songInfo;
@@ -107,6 +116,17 @@ char cachedAlbum[19] = { 0 };
 char cachedPlayTime[19] = { 0 };
 char blankLine[21] = { 0 };
 
+// Filled by the ESP-NOW callback, emptied by loop() - state switches and the LCD are only touched from loop()
+struct PendingMessage
+{
+    CarDataType type;
+    uint8_t data[sizeof(BTInfoMsg)]; // Largest message we receive
+};
+
+PendingMessage pendingMessages[PENDING_MESSAGES];
+volatile uint8_t pendingHead; // Next to handle, only loop() moves it
+volatile uint8_t pendingTail; // Next free, only the callback moves it
+
 
 void switchStateInstant(State endState);
 void switchStateWithIntermediate(State endState, State intermediateState, uint32_t timeInIntermediateStateMS);
@@ -118,11 +138,14 @@ void setup()
     delay(1000);
 
     lcd.init();
+    lcd.setClock();  // 400 kHz, prints go out in one transmission per line
     lcd.backlight();
 
     initIcons();  // Icons.h
     initDial();
 
+    scheduler.setRenderHandler(render, nullptr, DISPLAY_FRAME_MS);
+
 #ifdef DEBUG
     Serial.begin(115200);
     esp_log_level_set("*", ESP_LOG_INFO);
@@ -142,6 +165,8 @@ void initDial()
     dial.begin(ROTARY_PIN1, ROTARY_PIN2, CLICKS_PER_ROTATION);
     dial.setLeftRotationHandler(rotateLeft);
     dial.setRightRotationHandler(rotateRight);
+    dial.attachInterrupts();  // Don't drop steps while the LCD is being written
+    dial.setAcceleration(DIAL_MAX_ACCELERATION);
 
     dialButton.begin(ROTARY_BUTTON);
     dialButton.setClickHandler(click);
@@ -157,34 +182,10 @@ void loop()
     dial.loop();
     dialButton.loop();
 
-    switch (state)
-    {
-        case STATE_IDLE:
-            if (timeSinceStateSwitchedMS() > TIME_FROM_IDLE_TO_SLEEP_MS)
-            {
-                switchStateWithIntermediate(STATE_SLEEP, STATE_TRANSITION_MESSAGE, MESSAGE_SLEEP_TIME);
-                displayMessage("Sleeping in", "3 seconds...", false);
-            }
-            break;
-    }
-
-    // Check if we are waiting for a state switch
-    if (stateSwitchTimeMS != 0)
-    {   
-        // We set stateSwitchTimeMS to millis() + delay, so if it is less than current time it has elapsed
-        if (stateSwitchTimeMS < millis())
-        {
-            stateSwitchTimeMS = 0;
-            stateTimerCB(nullptr);
-        }
-    }
+    handlePendingMessages();
 
-    // Should we turn connection back on?
-    if (waitingToSetConnectable && (disconnectTime + DISCONNECT_SET_UNCONNECTABLE_TIME) < millis())
-    {
-        waitingToSetConnectable = false;
-        setConnectable(true);
-    }
+    // State timeouts, connection timers and display refreshes
+    scheduler.loop();
 }
 
 void checkError()
@@ -207,11 +208,30 @@ void stateTimerCB(void* arg)
     switchStateInstant(nextState);
 }
 
+void idleSleepTimerCB(void* arg)
+{
+    if (state != STATE_IDLE)
+        return;
+
+    switchStateWithIntermediate(STATE_SLEEP, STATE_TRANSITION_MESSAGE, MESSAGE_SLEEP_TIME);
+    displayMessage("Sleeping in", "3 seconds...", false);
+}
+
+void setConnectableTimerCB(void* arg)
+{
+    setConnectable(true);
+}
+
+void connectTimerCB(void* arg)
+{
+    connect(connectAddress);
+}
+
 void switchStateInstant(State endState)
 {
     State previous = state;
 
-    stateSwitchTimeMS = 0;
+    scheduler.cancel(stateSwitchTask);
     switchingState = false;  // TODO: Maybe move this to stateTimerCB and return from the fn if switchingState?
     state = endState;
     lastStateSwitchTimeMS = millis();
@@ -224,9 +244,8 @@ void switchStateWithIntermediate(State endState, State intermediateState, uint32
     switchingState = true;
     State previous = state;
 
-    //esp_timer_stop(stateSwitchTimer);                                          // Stop before (re)starting
-    //esp_timer_start_once(stateSwitchTimer, timeInIntermediateStateMS * 1000);  // Convert to us from ms
-    stateSwitchTimeMS = millis() + timeInIntermediateStateMS;
+    scheduler.cancel(stateSwitchTask);  // Stop before (re)starting
+    stateSwitchTask = scheduler.once(timeInIntermediateStateMS, stateTimerCB);
     nextState = endState;
     state = intermediateState;
     lastStateSwitchTimeMS = millis();
@@ -247,6 +266,9 @@ void afterStateSwitched(State from, State to)
         case STATE_SLEEP:
             lcd.backlight();  // Turn display back on
             break;
+        case STATE_IDLE:
+            scheduler.cancel(idleSleepTask);
+            break;
         case STATE_DISCOVERABLE:
             setDiscoverable(false);  // Back into hiding
             break;
@@ -262,6 +284,7 @@ void afterStateSwitched(State from, State to)
         case STATE_IDLE:
             lcd.clear();
             displayMessage("No device connected", "Press to enter menu", false);
+            idleSleepTask = scheduler.once(TIME_FROM_IDLE_TO_SLEEP_MS, idleSleepTimerCB);
             break;
         case STATE_DISCOVERABLE:
             setDiscoverable(true);  // Make visible to pairing
@@ -341,7 +364,32 @@ void splashScreen()
     lcd.print("System booting...");
 }
 
+// ESP-NOW callback, runs on the WiFi task - only copies the message for loop()
 void handleCarData(CarDataType type, const uint8_t* data, int len)
+{
+    uint8_t next = (pendingTail + 1) % PENDING_MESSAGES;
+    if (next == pendingHead || len > (int)sizeof(BTInfoMsg))
+        return; // Full, the audio module rebroadcasts its state anyway
+
+    PendingMessage& message = pendingMessages[pendingTail];
+    message.type = type;
+    memcpy(message.data, data, len);
+    __sync_synchronize(); // Message is written before loop() can see it
+    pendingTail = next;
+}
+
+void handlePendingMessages()
+{
+    while (pendingHead != pendingTail)
+    {
+        __sync_synchronize();
+        PendingMessage& message = pendingMessages[pendingHead];
+        onCarData(message.type, message.data);
+        pendingHead = (pendingHead + 1) % PENDING_MESSAGES;
+    }
+}
+
+void onCarData(CarDataType type, const uint8_t* data)
 {
     //log_i("Got car data. Type: %d", type);
 
@@ -356,20 +404,20 @@ void handleCarData(CarDataType type, const uint8_t* data, int len)
                     switch (msg->songUpdate.updateType)
                     {
                         case BT_SONG_POS_UPDATE_TRACK_CHANGE:
-                            displayMusic();
+                            scheduler.requestRender();
                             break;
                         case BT_SONG_POS_UPDATE_PLAY_STATUS_CHANGE:
                             // msg->songUpdate.
                             // uint8_t playback; // esp_avrc_playback_stat_t
                             log_i("Playback: %d", msg->songUpdate.playback);
                             playbackStatus = msg->songUpdate.playback;
-                            displayMusic();
+                            scheduler.requestRender();
                             break;
                         case BT_SONG_POS_UPDATE_PLAY_POS_CHANGED:
                             // msg->songUpdate.
                             // uint32_t playPosMS;
                             playPosMS = msg->songUpdate.playPosMS;
-                            displayMusic();
+                            scheduler.requestRender();
                             break;
                     }
                     break;
@@ -387,7 +435,7 @@ void handleCarData(CarDataType type, const uint8_t* data, int len)
                     // Store song info
                     memcpy(&songInfo, msg, sizeof(BTInfoMsg));
                     playbackStatus = songInfo.songInfo.playStatus;
-                    displayMusic();
+                    scheduler.requestRender();
                     // msg->songInfo.
                     // char title[BT_SONG_INFO_MAX_STR_LEN]; // 64 bytes
                     // char artist[BT_SONG_INFO_MAX_STR_LEN]; // 128
@@ -426,7 +474,7 @@ void handleCarData(CarDataType type, const uint8_t* data, int len)
                         case STATE_SETTINGS_DEVICE_LIST:
                         case STATE_SETTINGS_DEVICE:
                             if (devicesChanged)
-                                selectedOptionChanged();  // Re-display settings
+                                scheduler.requestRender();  // Re-display settings
                     }
 
 
@@ -697,17 +745,10 @@ void rotateLeft(Rotary& dial)
     if (state == STATE_SLEEP)
         switchStateInstant(STATE_IDLE);
     else if (state == STATE_SETTINGS_MAIN || state == STATE_SETTINGS_DEVICE || state == STATE_SETTINGS_DEVICE_LIST)
-    {
-        // Decrement option, wrapping around
-        // Note: numOptions is set when the state is changed
-        selectedOption--;
-        if (selectedOption < 0)
-            selectedOption = numOptions - 1;
-
-        selectedOptionChanged();
-    }
+        moveSelectedOption(dial.getAcceleratedDelta());
     else if (state == STATE_DISPLAY)
-        skipBackward();
+        for (int i = abs(dial.getDetents()); i > 0; i--) // One track per click, not accelerated
+            skipBackward();
 }
 
 void rotateRight(Rotary& dial)
@@ -717,17 +758,48 @@ void rotateRight(Rotary& dial)
     if (state == STATE_SLEEP)
         switchStateInstant(STATE_IDLE);
     else if (state == STATE_SETTINGS_MAIN || state == STATE_SETTINGS_DEVICE || state == STATE_SETTINGS_DEVICE_LIST)
+        moveSelectedOption(dial.getAcceleratedDelta());
+    else if (state == STATE_DISPLAY)
+        for (int i = abs(dial.getDetents()); i > 0; i--) // One track per click, not accelerated
+            skipForward();
+}
+
+void moveSelectedOption(int delta)
+{
+    // Note: numOptions is set when the state is changed
+    selectedOption += delta;
+
+    if (delta == 1 || delta == -1)
     {
-        // Increment option, wrapping around
-        // Note: numOptions is set when the state is changed
-        selectedOption++;
-        if (selectedOption >= numOptions)
+        // Single detent, wrap around
+        if (selectedOption < 0)
+            selectedOption = numOptions - 1;
+        else if (selectedOption >= numOptions)
             selectedOption = 0;
+    }
+    else
+    {
+        // Fast spin (or several detents at once), stop at the ends instead of flying past
+        selectedOption = constrain(selectedOption, 0, numOptions - 1);
+    }
 
-        selectedOptionChanged();
+    scheduler.requestRender();
+}
+
+// Called by the scheduler at most once per DISPLAY_FRAME_MS, however many updates came in
+void render(void* arg)
+{
+    switch (state)
+    {
+        case STATE_DISPLAY:
+            displayMusic();
+            break;
+        case STATE_SETTINGS_DEVICE_LIST:
+        case STATE_SETTINGS_DEVICE:
+        case STATE_SETTINGS_MAIN:
+            selectedOptionChanged();
+            break;
     }
-    else if (state == STATE_DISPLAY)
-        skipForward();
 }
 
 void selectedOptionChanged()
@@ -959,12 +1031,10 @@ void device_click()
                 disconnect();
                 switchStateInstant(STATE_CONNECTING);
                 displayMessage("Connecting to", devices.devices.deviceNames[selectedDevice], true);
-                // I don't feel like working out the logic for connecting once the radio is back on
-                //  so I'll just call setConnectable from here
-                delay(DISCONNECT_SET_UNCONNECTABLE_TIME); // Give time to disconnect and turn connection back on
-                setConnectable(true);
-                delay(250);
-                connect(devices.devices.addresses[selectedDevice]);
+                // disconnect() turns connection back on after DISCONNECT_SET_UNCONNECTABLE_TIME, connect once that's happened
+                memcpy(connectAddress, devices.devices.addresses[selectedDevice], 6);
+                scheduler.cancel(connectTask);
+                connectTask = scheduler.once(DISCONNECT_SET_UNCONNECTABLE_TIME + CONNECT_AFTER_CONNECTABLE_TIME, connectTimerCB);
             }
             break;
         case SETTINGS_DEVICE_FAVOURITE:
@@ -1247,9 +1317,9 @@ void deleteDevice(uint8_t* device)
 void disconnect()
 {
     // Turn connection "off" so phone doesn't reconnect immediately
-    disconnectTime = millis();
-    waitingToSetConnectable = true;
     setConnectable(false);
+    scheduler.cancel(setConnectableTask);
+    setConnectableTask = scheduler.once(DISCONNECT_SET_UNCONNECTABLE_TIME, setConnectableTimerCB);
 
     BTTrackUpdateMsg msg;
     msg.type = BTTrackUpdateType::BT_UPDATE_DEVICE_DISCONNECT;
@@ -8,6 +8,8 @@
 #include <Arduino.h>
 #include <U8g2lib.h>
 #include <CarComms.h>
+#include <CarScheduler.h>
+#include <CarWidgets.h>
 
 // #ifdef U8X8_HAVE_HW_SPI
 // #include <SPI.h>
@@ -16,48 +18,52 @@
 #include <Wire.h>
 #endif
 
-const unsigned char bmp_coolant[] PROGMEM = {
-    // 'Coolant temp, 24x24px
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
-    0xf8, 0x03, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x18,
-    0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00,
-    0x0c, 0x3c, 0x30, 0x92, 0x3c, 0x49, 0x61, 0x18, 0x86, 0x00, 0x00, 0x00, 0x0c, 0xc3, 0x30, 0xf2,
-    0x3c, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+// Coolant temp, 24x24px
+// Compiled bitmap for drawCompiledBitmap() (U8g2_Arduino/extras/tools/bmp2tiles.py --compiled)
+const unsigned char cbmp_coolant[] PROGMEM = {
+    0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x92, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x22, 0x11, 0x11, 0x22, 0x24, 0x24, 0x22, 0x10, 0x10, 0x23, 0x27, 0x27, 0x23,
+    0x10, 0x10, 0x22, 0x24, 0x24, 0x22, 0x11, 0x11, 0x22, 0x04,
 };
 
 
-U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE);
+// Shadow of the display RAM (1 KB): tiles that were redrawn with the same content are not sent again
+U8G2_SHADOW<U8G2_SSD1306_128X64_NONAME_F_HW_I2C> u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE);
 //U8G2_SSD1306_128X64_ALT0_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);   // same as the NONAME variant, but may solve the "every 2nd line skipped" problem
 //U8G2_SSD1306_128X64_NONAME_F_SW_I2C u8g2(U8G2_R0, /* clock=*/ 13, /* data=*/ 11, /* reset=*/ 8);
 //U8G2_SSD1306_128X64_NONAME_F_SW_I2C u8g2(U8G2_R0, /* clock=*/ SCL, /* data=*/ SDA, /* reset=*/ U8X8_PIN_NONE);   // All Boards without Reset of the Display
 //U8G2_SSD1306_128X64_NONAME_F_SW_I2C u8g2(U8G2_R0, /* clock=*/ 16, /* data=*/ 17, /* reset=*/ U8X8_PIN_NONE);   // ESP32 Thing, pure SW emulated I2C
 //U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE, /* clock=*/ 16, /* data=*/ 17);   // ESP32 Thing, HW I2C with pin remapping
 
-// https://github.com/olikraus/u8g2/discussions/2028
-#define ALIGN_CENTER(t) (u8g2.getStrWidth(t) / 2)
-#define ALIGN_RIGHT(t) (u8g2.getStrWidth(t))
-#define ALIGN_LEFT 0
-
 #define INFO_SCREEN_DELAY 3000
 
 CarComms comms(handleCarData);
+CarScheduler scheduler;
 
 #define MIN_DISPLAY_DELAY_MS 200
+#define PENDING_MESSAGES 4 // ESP-NOW messages waiting for loop()
+
+// Latest data, only touched from loop()
+CarInfoMsg latestInfo;
 
-long lastDisplayTime;
+// Filled by the ESP-NOW callback, emptied by loop() - render() never sees a half-copied message
+CarInfoMsg pendingMessages[PENDING_MESSAGES];
+volatile uint8_t pendingHead; // Next to handle, only loop() moves it
+volatile uint8_t pendingTail; // Next free, only the callback moves it
 
 #define FONT_KM_REMAINING u8g2_font_spleen16x32_mn
 #define FONT_LARGE u8g2_font_7x13_tr
 #define FONT_SMALL u8g2_font_5x7_tr
 #define FONT_TINY u8g2_font_tiny5_tr
 
-char buffer[128];
-
 void setup(void)
 {
     u8g2.begin();
     comms.begin();
     comms.receiveTypeMask = CarDataType::ID_CARINFO;
+    scheduler.setRenderHandler(render, nullptr, MIN_DISPLAY_DELAY_MS);  // Don't refresh every 100ms
 
     u8g2.clearBuffer();
 
@@ -68,79 +74,50 @@ void setup(void)
     u8g2.sendBuffer();
 }
 
-void displayInfo(CarInfoMsg& info)
-{
-    // Don't refresh every 100ms
-    if (millis() - lastDisplayTime < MIN_DISPLAY_DELAY_MS)
-        return;
-
-    lastDisplayTime = millis() + MIN_DISPLAY_DELAY_MS;
-
-
-    // TODO: Don't clear the buffer every time, draw spaces instead
-    // TODO: Only redraw info that has changed (see BluetoothController)
-    // TODO: Make actual proper display lol
-    u8g2.clearBuffer();
-
-    // "682" (distance)
-    u8g2.setFont(FONT_KM_REMAINING);
-    sprintf(buffer, "%d", info.kmRemaining);
-    u8g2.setCursor(48 - ALIGN_RIGHT(buffer), 30);
-    u8g2.print(buffer);
-
-    // "Range"
-    u8g2.setFont(FONT_SMALL);
-    u8g2.setCursor(20, 6);
-    u8g2.print("Range");
-
-    // "km"
-    u8g2.setFont(FONT_LARGE);
-    u8g2.setCursor(52, 30);
-    u8g2.print("km");
+// Redrawn only when the shown value changes, see CarWidgets
+const Widget infoLayout[] = {
+    // "682" (distance), the font box of the digits reaches into "Range" which is redrawn with it
+    WIDGET_LABEL(20, 6, FONT_SMALL, "Range"),
+    WIDGET_NUMBER(CarInfoMsg, kmRemaining, 48, 30, 48, FONT_KM_REMAINING, 0, nullptr, nullptr),
+    WIDGET_LABEL(52, 30, FONT_LARGE, "km"),
 
     // Avg. / Inst. eco
-    u8g2.setFont(FONT_SMALL);
-    u8g2.setCursor(1, 46);
-    u8g2.print(" Avg");
-    u8g2.setCursor(1, 61);
-    u8g2.print("Inst");
-
-    // Fuel eco numbers
-    u8g2.setFont(FONT_LARGE);
-    sprintf(buffer, "%.1f", info.fuelEcoAvg);
-    u8g2.setCursor(52 - ALIGN_RIGHT(buffer), 48);
-    if (info.fuelEcoAvg != 0)
-        u8g2.print(buffer);
-    else
-        u8g2.print("---");
-    sprintf(buffer, "%.1f", info.fuelEcoInst);
-    u8g2.setCursor(52 - ALIGN_RIGHT(buffer), 63);
-    u8g2.print(buffer);
-
-    // L/100km
-    u8g2.setFont(FONT_TINY);
-    u8g2.setCursor(56, 48);
-    u8g2.print("L/100km");
-    u8g2.setCursor(56, 63);
-    u8g2.print("L/100km");
+    WIDGET_LABEL(1, 46, FONT_SMALL, " Avg"),
+    WIDGET_NUMBER(CarInfoMsg, fuelEcoAvg, 52, 48, 30, FONT_LARGE, 1, nullptr, "---"),
+    WIDGET_LABEL(56, 48, FONT_TINY, "L/100km"),
+    WIDGET_LABEL(1, 61, FONT_SMALL, "Inst"),
+    WIDGET_NUMBER(CarInfoMsg, fuelEcoInst, 52, 63, 30, FONT_LARGE, 1, nullptr, nullptr),
+    WIDGET_LABEL(56, 63, FONT_TINY, "L/100km"),
 
     // Coolant
-    u8g2.drawXBMP(104, 0, 24, 24, bmp_coolant);
-    u8g2.setFont(FONT_LARGE);
-    sprintf(buffer, "%dc", info.coolantTemp);
-    u8g2.setCursor(128 - ALIGN_RIGHT(buffer), 35);
-    u8g2.print(buffer);
+    WIDGET_BITMAP(104, 0, cbmp_coolant),
+    WIDGET_NUMBER(CarInfoMsg, coolantTemp, 128, 35, 35, FONT_LARGE, 0, "c", nullptr),
+};
 
-    u8g2.sendBuffer();
+WidgetState infoState[WIDGET_COUNT(infoLayout)];
+CarWidgets widgets(u8g2, infoLayout, infoState);
+
+// Called by the scheduler at most once per MIN_DISPLAY_DELAY_MS, however many messages came in
+void render(void* arg)
+{
+    // Copied and sent by a background task on the ESP32, so the next frame
+    // can be drawn while this one is still on the bus
+    if (widgets.update(&latestInfo))
+        u8g2.sendBufferAsync();
 }
 
+// ESP-NOW callback, runs on the WiFi task - only copies the message for loop()
 void handleCarData(CarDataType type, const uint8_t* data, int len)
 {
-    if (type == CarDataType::ID_CARINFO)
+    if (type == CarDataType::ID_CARINFO && len == sizeof(CarInfoMsg))
     {
-        CarInfoMsg info;
-        memcpy(&info, data, sizeof(CarInfoMsg));
-        displayInfo(info);
+        uint8_t next = (pendingTail + 1) % PENDING_MESSAGES;
+        if (next == pendingHead)
+            return; // Full, the next message has newer data anyway
+
+        memcpy(&pendingMessages[pendingTail], data, sizeof(CarInfoMsg));
+        __sync_synchronize(); // Message is written before loop() can see it
+        pendingTail = next;
         /*  
         CarInfoMsg* info = (CarInfoMsg*)data;
         Serial.print("Got data. RPM: ");
@@ -151,6 +128,22 @@ void handleCarData(CarDataType type, const uint8_t* data, int len)
     }
 }
 
+void handlePendingMessages()
+{
+    if (pendingHead == pendingTail)
+        return;
+
+    while (pendingHead != pendingTail)
+    {
+        __sync_synchronize();
+        memcpy(&latestInfo, &pendingMessages[pendingHead], sizeof(CarInfoMsg));
+        pendingHead = (pendingHead + 1) % PENDING_MESSAGES;
+    }
+    scheduler.requestRender();
+}
+
 void loop(void)
 {
+    handlePendingMessages();
+    scheduler.loop();
 }
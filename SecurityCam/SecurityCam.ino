@@ -7,6 +7,13 @@
 #include "./const.h"
 
 //#define SERIAL_DEBUG
+#define MOTION_GATING  // Only upload when the scene changed, see motion.h
+#define ADAPTIVE_QUALITY  // Fit JPEG quality/size to the link, see quality.h
+//#define BURST_ON_MOTION  // Motion takes a burst instead of one picture, see burst.h
+//#define BURST_CARCOMMS  // A car door opening takes a burst
+
+#define SEND_INTERVAL 5000  // With MOTION_GATING the least time between uploads
+#define WIFI_CONNECT_INTERVAL 30000
 
 #if defined(SERIAL_DEBUG)
 #define DBG(x) Serial.println(x)
@@ -16,15 +23,12 @@
 
 #include "time.h"
 #include "./connect.h"
+#include "./clock.h"
 #include "./ftp.h"
 #include "./cam.h"
-
-#define SEND_INTERVAL 5000
-#define WIFI_CONNECT_INTERVAL 30000
-
-
-const char* ntpServer = "pool.ntp.org";
-bool timeInited = false;
+#include "./motion.h"
+#include "./stream.h"
+#include "./quality.h"
 
 
 void setup()
@@ -37,60 +41,87 @@ void setup()
 #ifdef SERIAL_DEBUG
     Serial.begin(115200);
     Serial.setDebugOutput(true);
+#elif defined(QUALITY_BENCHMARK)
+    Serial.begin(115200);
 #endif
 
+    clockInit();
+    burstInit();
     wifiInit();
     wifiConnect();
+    uploadInit();
+    streamInit();
 }
 
-void initTime()
+void loop()
 {
-    configTime(0, 0, ntpServer);
+    unsigned long current_millis = millis();
 
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo))
+    if (!wifi_connected && current_millis - connect_timer >= WIFI_CONNECT_INTERVAL)
     {
-        Serial.println("Failed to obtain time");
-        return;
+        connect_timer = current_millis;
+        wifiConnect();
     }
 
-    setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);  //  Now adjust the TZ.  Clock settings are adjusted to show the new local time
-    tzset();
-    timeInited = true;
-}
-
-void loop()
-{
-    unsigned long current_millis = millis();
-
-    if (wifi_connected)
+    // Pictures are still taken without Wi-Fi, the upload task keeps them in the backlog
+#if defined(MOTION_GATING)
+    if (current_millis - motion_timer >= MOTION_INTERVAL)
     {
-        if (!timeInited)
-            initTime();
+        motion_timer = current_millis;
 
-        if (current_millis - send_timer >= SEND_INTERVAL)
+        if (!cam_init_ok)
         {
-            send_timer = current_millis;
+            cam_init_ok = cameraInit();
+        }
 
-            if (!cam_init_ok)
-            {
-                cam_init_ok = cameraInit();
-            }
+        // Probe even right after an upload, so the background keeps up with the scene.
+        // Not while streaming, probes would drop the stream to QQVGA - snapshots go out every SEND_INTERVAL then
+        if (cam_init_ok && (streamActive() || motionDetected()) && current_millis - send_timer >= SEND_INTERVAL)
+        {
+            send_timer = current_millis;
+#if defined(BURST_ON_MOTION)
+            if (takeBurst() > 0)
+#else
+            if (takePicture())
+#endif
+                motionStats.sent++;
 
-            if (cam_init_ok)
-            {
-                takePicture();
-            }
+            DBG("Probes skipped/sent:");
+            DBG(motionStats.skipped);
+            DBG(motionStats.sent);
         }
     }
-    else
+#else
+    if (current_millis - send_timer >= SEND_INTERVAL)
     {
-        if (current_millis - connect_timer >= WIFI_CONNECT_INTERVAL)
+        send_timer = current_millis;
+
+        if (!cam_init_ok)
+        {
+            cam_init_ok = cameraInit();
+        }
+
+        if (cam_init_ok)
         {
-            connect_timer = current_millis;
-            wifiConnect();
+            takePicture();
         }
     }
+#endif
+
+    // A door opened, see burst.h
+    if (burstRequested && cam_init_ok)
+    {
+        burstRequested = false;
+        takeBurst();
+    }
+
+    if (cam_init_ok)
+    {
+        streamPublish();
+#if defined(ADAPTIVE_QUALITY)
+        qualityUpdate();
+#endif
+    }
 
     yield();
 }
@@ -0,0 +1,378 @@
+#include "FS.h"
+#if defined(BACKLOG_SD)
+#include "SD_MMC.h"
+#define BACKLOG_FS SD_MMC
+#else
+#include "LittleFS.h"
+#define BACKLOG_FS LittleFS
+#endif
+
+// Frames that couldn't be uploaded (no Wi-Fi, transfer failed) wait here, oldest first.
+// The newest BACKLOG_RAM_FRAMES stay in PSRAM, older ones spill to the file system:
+//   /backlog/index   BacklogRecord per spilled frame, only ever appended
+//   /backlog/head    Number of index records already uploaded, replaced by rename
+//   /backlog/<seq>   The JPEG
+// A crash at any point leaves at worst a record whose file is gone or short, which is skipped,
+// or an orphan file with the next sequence number, which the next spill overwrites.
+
+#define BACKLOG_RAM_FRAMES 6
+#define BACKLOG_DISK_FRAMES 500     // Oldest spilled frames are dropped beyond this, or once the file system is full
+#define BACKLOG_DRAIN_INTERVAL 2000 // ms between backlog uploads once FTP works again
+#define BACKLOG_DIR "/backlog"
+#define BACKLOG_INDEX BACKLOG_DIR "/index"
+#define BACKLOG_HEAD BACKLOG_DIR "/head"
+#define BACKLOG_MAGIC 0x4B4C4342  // "BCLK"
+
+struct BacklogRecord
+{
+    uint32_t magic;
+    uint32_t seq;
+    uint32_t size;
+    uint32_t captureTime;  // clockNow(), seconds, 0 if the clock wasn't set yet
+    char name[40];
+    uint32_t check;        // FNV-1a of everything above, catches a torn append
+};
+
+struct BacklogFrame
+{
+    uint8_t *data;
+    size_t size;
+    uint32_t captureTime;
+    char name[40];
+};
+
+// Oldest frame, as handed out by backlogPeek()
+struct BacklogEntry
+{
+    const uint8_t *data;  // RAM frame, NULL when it is on disk
+    File file;            // Disk frame
+    size_t size;
+    char name[40];
+};
+
+struct BacklogStats
+{
+    uint16_t ramFrames;
+    uint16_t diskFrames;
+    uint32_t oldestTime;  // captureTime of the oldest frame
+    unsigned long spilled;
+    unsigned long drained;
+    unsigned long dropped;  // Backlog full, or nowhere to spill
+};
+
+BacklogStats backlogStats;
+BacklogFrame backlogRam[BACKLOG_RAM_FRAMES];
+uint8_t backlogRamHead = 0;  // Oldest RAM frame
+bool backlog_fs_ok = false;
+uint32_t backlogDiskHead = 0;  // First index record not uploaded yet
+uint32_t backlogDiskTail = 0;  // Index records
+uint32_t backlogNextSeq = 0;
+uint8_t backlogChunk[FTP_WRITE_CHUNK];
+
+uint32_t backlogCheck(const BacklogRecord &rec) {
+    const uint8_t *p = (const uint8_t *)&rec;
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < offsetof(BacklogRecord, check); i++)
+        hash = (hash ^ p[i]) * 16777619u;
+    return hash;
+}
+
+void backlogPath(char *path, uint32_t seq) {
+    sprintf(path, BACKLOG_DIR "/%lu", (unsigned long)seq);
+}
+
+bool backlogReadRecord(uint32_t index, BacklogRecord &rec) {
+    File f = BACKLOG_FS.open(BACKLOG_INDEX, FILE_READ);
+    if (!f)
+        return false;
+    bool ok = f.seek(index * sizeof(rec)) && f.read((uint8_t *)&rec, sizeof(rec)) == sizeof(rec);
+    f.close();
+    return ok && rec.magic == BACKLOG_MAGIC && rec.check == backlogCheck(rec);
+}
+
+// LittleFS replaces the target atomically. FAT (the SD card) refuses an existing one, a crash
+// between remove and rename there leaves only the .tmp, which backlogRecover() puts back.
+bool backlogReplace(const char *tmp, const char *path) {
+    if (BACKLOG_FS.rename(tmp, path))
+        return true;
+    BACKLOG_FS.remove(path);
+    return BACKLOG_FS.rename(tmp, path);
+}
+
+bool backlogWriteHead() {
+    File f = BACKLOG_FS.open(BACKLOG_HEAD ".tmp", FILE_WRITE);
+    if (!f)
+        return false;
+    f.write((const uint8_t *)&backlogDiskHead, sizeof(backlogDiskHead));
+    f.close();
+    return backlogReplace(BACKLOG_HEAD ".tmp", BACKLOG_HEAD);
+}
+
+// A .tmp next to its target was still being written, drop it. One without a target
+// was complete, only the rename over the target didn't happen.
+void backlogRecover(const char *path) {
+    char tmp[32];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    if (!BACKLOG_FS.exists(tmp))
+        return;
+    if (BACKLOG_FS.exists(path))
+        BACKLOG_FS.remove(tmp);
+    else
+        BACKLOG_FS.rename(tmp, path);
+}
+
+void backlogUpdateStats() {
+    backlogStats.diskFrames = backlogDiskTail - backlogDiskHead;
+
+    BacklogRecord rec;
+    if (backlogStats.diskFrames > 0 && backlogReadRecord(backlogDiskHead, rec))
+        backlogStats.oldestTime = rec.captureTime;
+    else if (backlogStats.ramFrames > 0)
+        backlogStats.oldestTime = backlogRam[backlogRamHead].captureTime;
+    else
+        backlogStats.oldestTime = 0;
+}
+
+// Seconds the oldest waiting frame has been waiting, 0 if unknown (taken or checked before SNTP sync)
+uint32_t backlogOldestAge() {
+    if (backlogStats.ramFrames == 0 && backlogStats.diskFrames == 0)
+        return 0;
+    if (backlogStats.oldestTime == 0 || !clockValid())
+        return 0;
+    time_t now = clockNow();
+    if (now < (time_t)backlogStats.oldestTime)
+        return 0;
+    return now - backlogStats.oldestTime;
+}
+
+// Rewrites the index with only the records still waiting, so it doesn't grow forever
+void backlogCompact() {
+    File in = BACKLOG_FS.open(BACKLOG_INDEX, FILE_READ);
+    File out = BACKLOG_FS.open(BACKLOG_INDEX ".tmp", FILE_WRITE);
+    uint32_t kept = 0;
+    if (in && out) {
+        in.seek(backlogDiskHead * sizeof(BacklogRecord));
+        BacklogRecord rec;
+        // A short last record is a torn append, it ends the loop
+        while (in.read((uint8_t *)&rec, sizeof(rec)) == sizeof(rec)) {
+            if (rec.magic != BACKLOG_MAGIC || rec.check != backlogCheck(rec))
+                continue;
+            out.write((const uint8_t *)&rec, sizeof(rec));
+            kept++;
+            backlogNextSeq = rec.seq + 1;
+        }
+    }
+    if (in)
+        in.close();
+    if (out)
+        out.close();
+
+    // Without the head file all records count as waiting, the new index only holds those.
+    // The old index stays until the new one replaces it, until then a crash just means
+    // records of already uploaded frames, whose files are gone, and those are skipped.
+    BACKLOG_FS.remove(BACKLOG_HEAD);
+    if (kept > 0) {
+        backlogReplace(BACKLOG_INDEX ".tmp", BACKLOG_INDEX);
+    } else {
+        BACKLOG_FS.remove(BACKLOG_INDEX);
+        // Nothing waits, anything left in the directory is an orphan
+        File dir = BACKLOG_FS.open(BACKLOG_DIR);
+        char path[40];
+        for (File f = dir.openNextFile(); f; f = dir.openNextFile()) {
+            snprintf(path, sizeof(path), "%s", f.path());
+            f.close();
+            BACKLOG_FS.remove(path);
+        }
+        dir.close();
+        backlogNextSeq = 0;
+    }
+
+    backlogDiskHead = 0;
+    backlogDiskTail = kept;
+}
+
+bool backlogInit() {
+#if defined(BACKLOG_SD)
+    // 1-bit mode leaves GPIO 4 to the flash LED
+    backlog_fs_ok = SD_MMC.begin("/sdcard", true);
+#else
+    backlog_fs_ok = LittleFS.begin(true);
+#endif
+    if (!backlog_fs_ok) {
+        DBG("Backlog storage failed, RAM only");
+        return false;
+    }
+
+    BACKLOG_FS.mkdir(BACKLOG_DIR);
+    backlogRecover(BACKLOG_INDEX);
+    backlogRecover(BACKLOG_HEAD);
+
+    File f = BACKLOG_FS.open(BACKLOG_HEAD, FILE_READ);
+    if (f) {
+        if (f.read((uint8_t *)&backlogDiskHead, sizeof(backlogDiskHead)) != sizeof(backlogDiskHead))
+            backlogDiskHead = 0;
+        f.close();
+    }
+    backlogCompact();
+    backlogUpdateStats();
+
+    DBG("Backlog frames on disk:");
+    DBG(backlogStats.diskFrames);
+    return true;
+}
+
+void backlogDropDiskHead() {
+    BacklogRecord rec;
+    char path[24];
+    if (backlogReadRecord(backlogDiskHead, rec)) {
+        backlogPath(path, rec.seq);
+        BACKLOG_FS.remove(path);
+    }
+
+    backlogDiskHead++;
+    if (backlogDiskHead >= backlogDiskTail)
+        backlogCompact();
+    else
+        backlogWriteHead();
+}
+
+// Moves the oldest RAM frame to disk, false if there is no disk to move it to
+bool backlogSpill() {
+    BacklogFrame &frame = backlogRam[backlogRamHead];
+    if (!backlog_fs_ok)
+        return false;
+
+    if (backlogDiskTail - backlogDiskHead >= BACKLOG_DISK_FRAMES) {
+        backlogDropDiskHead();
+        backlogStats.dropped++;
+    }
+
+    // The file goes first, a record never points to a frame that isn't written yet.
+    // LittleFS usually fills up long before BACKLOG_DISK_FRAMES, then the oldest spilled
+    // frames make room. Dropping can compact the index, so the sequence number comes after.
+    char path[24];
+    for (;;) {
+        backlogPath(path, backlogNextSeq);
+        File f = BACKLOG_FS.open(path, FILE_WRITE);
+        size_t written = 0;
+        if (f) {
+            written = f.write(frame.data, frame.size);
+            f.close();
+        }
+        if (written == frame.size)
+            break;
+
+        BACKLOG_FS.remove(path);
+        if (backlogDiskHead == backlogDiskTail)
+            return false;
+        backlogDropDiskHead();
+        backlogStats.dropped++;
+    }
+
+    BacklogRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.magic = BACKLOG_MAGIC;
+    rec.seq = backlogNextSeq++;
+    rec.size = frame.size;
+    rec.captureTime = frame.captureTime;
+    strcpy(rec.name, frame.name);
+    rec.check = backlogCheck(rec);
+
+    File index = BACKLOG_FS.open(BACKLOG_INDEX, FILE_APPEND);
+    if (!index) {
+        BACKLOG_FS.remove(path);
+        return false;
+    }
+    index.write((const uint8_t *)&rec, sizeof(rec));
+    index.close();
+    backlogDiskTail++;
+    backlogStats.spilled++;
+    return true;
+}
+
+void backlogFreeRamHead() {
+    free(backlogRam[backlogRamHead].data);
+    backlogRam[backlogRamHead].data = NULL;
+    backlogRamHead = (backlogRamHead + 1) % BACKLOG_RAM_FRAMES;
+    backlogStats.ramFrames--;
+}
+
+// Copies the frame, the camera buffer can be returned right after
+void backlogPush(const uint8_t *data, size_t size, const char *name) {
+    if (backlogStats.ramFrames == BACKLOG_RAM_FRAMES) {
+        if (!backlogSpill())
+            backlogStats.dropped++;
+        backlogFreeRamHead();
+    }
+
+    uint8_t *copy = (uint8_t *)ps_malloc(size);
+    if (!copy) {
+        backlogStats.dropped++;
+        return;
+    }
+    memcpy(copy, data, size);
+
+    BacklogFrame &frame = backlogRam[(backlogRamHead + backlogStats.ramFrames) % BACKLOG_RAM_FRAMES];
+    frame.data = copy;
+    frame.size = size;
+    frame.captureTime = clockValid() ? clockNow() : 0;
+    strncpy(frame.name, name, sizeof(frame.name) - 1);
+    frame.name[sizeof(frame.name) - 1] = 0;
+    backlogStats.ramFrames++;
+    backlogUpdateStats();
+}
+
+bool backlogEmpty() {
+    return backlogStats.ramFrames == 0 && backlogDiskHead == backlogDiskTail;
+}
+
+// Oldest frame, disk before RAM since everything on disk was spilled from RAM earlier.
+// Unreadable disk records are dropped on the way.
+bool backlogPeek(BacklogEntry &entry) {
+    while (backlogDiskHead < backlogDiskTail) {
+        BacklogRecord rec;
+        char path[24];
+        if (backlogReadRecord(backlogDiskHead, rec)) {
+            backlogPath(path, rec.seq);
+            entry.file = BACKLOG_FS.open(path, FILE_READ);
+            if (entry.file && entry.file.size() == rec.size) {
+                entry.data = NULL;
+                entry.size = rec.size;
+                strcpy(entry.name, rec.name);
+                return true;
+            }
+            if (entry.file)
+                entry.file.close();
+        }
+        backlogDropDiskHead();
+        backlogStats.dropped++;
+    }
+
+    if (backlogStats.ramFrames == 0)
+        return false;
+
+    BacklogFrame &frame = backlogRam[backlogRamHead];
+    entry.data = frame.data;
+    entry.size = frame.size;
+    strcpy(entry.name, frame.name);
+    return true;
+}
+
+// The entry from backlogPeek() was uploaded
+void backlogPop(BacklogEntry &entry) {
+    if (entry.data) {
+        backlogFreeRamHead();
+    } else {
+        entry.file.close();
+        backlogDropDiskHead();
+    }
+    backlogStats.drained++;
+    backlogUpdateStats();
+}
+
+// FTPChunkProvider streaming a disk entry's file from where it is positioned
+size_t backlogReadChunk(void *arg, const unsigned char **chunk) {
+    File *file = (File *)arg;
+    *chunk = backlogChunk;
+    return file->read(backlogChunk, sizeof(backlogChunk));
+}
@@ -0,0 +1,109 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#if defined(BURST_CARCOMMS)
+#include "CarComms.h"
+#endif
+
+// Burst capture: BURST_FRAMES pictures back to back at the sensor's own rate. Each one is
+// copied to PSRAM and its camera buffer returned right away, so the driver never runs out
+// of buffers mid-burst, and the upload task sends the copies as fast as the link allows.
+// Triggered by motion (BURST_ON_MOTION) or a car door opening (BURST_CARCOMMS), both set in
+// SecurityCam.ino. ESP-NOW only hears the car on the AP's channel, ESP_NOW_CHANNEL has to match it.
+
+#define BURST_FRAMES 5
+#define BURST_POOL_FRAMES 10  // Copies waiting for upload, a burst stops early when it's full
+
+struct BurstFrame
+{
+    uint8_t *data;  // ps_malloc'd copy, freed once uploaded or in the backlog
+    size_t size;
+    unsigned long takenMs;
+    char name[40];
+};
+
+struct BurstStats
+{
+    unsigned long bursts;
+    unsigned long frames;
+    unsigned long dropped;    // Pool full or out of PSRAM
+    unsigned long burstMs;    // Capture time of the last burst
+    uint8_t pendingPeak;      // Most copies ever waiting at once
+};
+
+BurstStats burstStats;
+QueueHandle_t burstQueue = NULL;
+volatile bool burstRequested = false;
+
+#if defined(BURST_CARCOMMS)
+bool doorsOpen = false;
+
+// Runs on the Wi-Fi task, the burst itself is taken by loop()
+void carDataReceived(CarDataType type, const uint8_t *data, int len) {
+    if (type != ID_CARINFO || len != sizeof(CarInfoMsg))
+        return;
+
+    const CarInfoMsg *info = (const CarInfoMsg *)data;
+    bool open = info->door_frontDriverOpen || info->door_frontPassengerOpen || info->door_rearDriverOpen ||
+                info->door_rearPassengerOpen || info->door_hatchOpen;
+    if (open && !doorsOpen)
+        burstRequested = true;
+    doorsOpen = open;
+}
+
+CarComms carComms(carDataReceived);
+#endif
+
+// Before wifiConnect(), CarComms sets the Wi-Fi mode
+void burstInit() {
+    burstQueue = xQueueCreate(BURST_POOL_FRAMES, sizeof(BurstFrame));
+#if defined(BURST_CARCOMMS)
+    carComms.setReceiveTypeMask(ID_CARINFO);
+    carComms.begin();
+#endif
+}
+
+uint8_t burstPending() {
+    return burstQueue ? uxQueueMessagesWaiting(burstQueue) : 0;
+}
+
+bool burstFull() {
+    return !burstQueue || uxQueueSpacesAvailable(burstQueue) == 0;
+}
+
+// Copies the frame into the pool, the camera buffer can go back right after
+bool burstPush(const camera_fb_t *fb, unsigned long takenMs, const char *name) {
+    if (burstFull()) {
+        burstStats.dropped++;
+        return false;
+    }
+
+    BurstFrame frame;
+    frame.data = (uint8_t *)ps_malloc(fb->len);
+    if (!frame.data) {
+        burstStats.dropped++;
+        return false;
+    }
+    memcpy(frame.data, fb->buf, fb->len);
+    frame.size = fb->len;
+    frame.takenMs = takenMs;
+    strncpy(frame.name, name, sizeof(frame.name) - 1);
+    frame.name[sizeof(frame.name) - 1] = 0;
+
+    // Only loop() pushes, the space checked above is still there
+    xQueueSend(burstQueue, &frame, 0);
+    burstStats.frames++;
+    uint8_t pending = burstPending();
+    if (pending > burstStats.pendingPeak)
+        burstStats.pendingPeak = pending;
+    return true;
+}
+
+// Oldest waiting copy, the caller frees it with burstFree()
+bool burstNext(BurstFrame &frame) {
+    return burstQueue && xQueueReceive(burstQueue, &frame, 0) == pdTRUE;
+}
+
+void burstFree(BurstFrame &frame) {
+    free(frame.data);
+    frame.data = NULL;
+}
@@ -6,8 +6,15 @@
 //#include "fd_forward.h"
 //#include "fr_forward.h"
 
+#define CAPTURE_FRAMESIZE FRAMESIZE_UXGA  // Largest size, quality.h may step down from here
+#define JPEG_QUALITY 16                   // 0-63 lower means higher quality
+#define GRAB_ATTEMPTS 4  // Frames dropped at most after a frame size change
+#define SHARED_FRAME_MAX_AGE 500  // ms, a stream frame this fresh is uploaded instead of capturing another
+
 unsigned long send_timer = 0;
 bool cam_init_ok = false;
+framesize_t cam_framesize = CAPTURE_FRAMESIZE;
+framesize_t capture_framesize = CAPTURE_FRAMESIZE;  // Size of uploaded/streamed pictures
 
 bool cameraInit() {
     camera_config_t config;
@@ -32,9 +39,9 @@ bool cameraInit() {
     config.xclk_freq_hz = 20000000;
     config.pixel_format = PIXFORMAT_JPEG;
 
-    config.frame_size = FRAMESIZE_UXGA;
-    config.jpeg_quality = 16;         // 0-63 lower means higher quality
-    config.fb_count = 2;
+    config.frame_size = CAPTURE_FRAMESIZE;
+    config.jpeg_quality = JPEG_QUALITY;
+    config.fb_count = CAMERA_FB_COUNT;
 
     // camera init
     esp_err_t err = esp_camera_init(&config);
@@ -50,40 +57,102 @@ bool cameraInit() {
     s->set_vflip(s, true);
     s->set_hmirror(s, true);
 
+    cam_framesize = CAPTURE_FRAMESIZE;
     DBG("CAM init ok");
     return true;
 }
 
-bool takePicture() {
-    DBG("Taking picture now");
-    camera_fb_t *fb = NULL;
-    fb = esp_camera_fb_get();
+// The sensor scales on its own, no reinit needed. Frames already queued at the
+// old size are dropped by grabFrame()
+void cameraSetFrameSize(framesize_t size) {
+    if (size == cam_framesize)
+        return;
 
-    if (!fb) {
-        DBG("Camera capture failed");
-        return false;
+    sensor_t *s = esp_camera_sensor_get();
+    s->set_framesize(s, size);
+    cam_framesize = size;
+}
+
+camera_fb_t *grabFrame() {
+    for (int i = 0; i < GRAB_ATTEMPTS; i++) {
+        camera_fb_t *fb = esp_camera_fb_get();
+        if (!fb)
+            return NULL;
+        if (fb->width == resolution[cam_framesize].width)
+            return fb;
+        esp_camera_fb_return(fb);
     }
+    return NULL;
+}
 
-    DBG("Camera capture success");
+// A frame at capture_framesize, empty if the camera or the pool had nothing.
+// Never waits for a stream client to give a buffer back, loop() would stall.
+FrameHandle captureFrame() {
+    if (!frameAvailable())
+        return FrameHandle();
+    cameraSetFrameSize(capture_framesize);
+    return FrameHandle::wrap(grabFrame());
+}
 
-    // Add timestamp to name
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo))
-    {
-        Serial.println("Failed to obtain time");
+bool takePicture() {
+    // The previous frame is still queued, don't hold a second buffer for nothing
+    if (!uploadReady()) {
+        DBG("Upload busy, skipping frame");
         return false;
     }
 
-    // https://cplusplus.com/reference/ctime/strftime/
-    char timestamp[32];
-    int numChars = strftime(timestamp, 32, "%a %b %d %H_%M_%S %Y", &timeinfo);
+    // While someone watches the stream, one capture feeds both
+    unsigned long captureMs = 0;
+    FrameHandle frame = FrameHandle::latest(0);
+    if (frame && millis() - frame.get()->takenMs > SHARED_FRAME_MAX_AGE)
+        frame.reset();
+
+    if (!frame) {
+        DBG("Taking picture now");
+        unsigned long start = millis();
+        frame = captureFrame();
+        if (!frame) {
+            DBG("Camera capture failed");
+            return false;
+        }
+        captureMs = millis() - start;
+        DBG("Camera capture success");
+    }
 
-    strcat(timestamp, ".jpg");
-    DBG(timestamp);
+    // Never waits for the clock, see clock.h
+    char name[40];
+    frameName(name, sizeof(name));
+    DBG(name);
 
-    uploadFile(fb->buf, fb->len, timestamp);
+    // Uploaded (and released) by the upload task while the next frame is captured
+    return queueUpload(frame, captureMs, name);
+}
 
-    esp_camera_fb_return(fb);
+// BURST_FRAMES pictures as fast as the sensor delivers them, the upload task sends them
+// in the background. Number taken, fewer when the burst pool fills up.
+int takeBurst() {
+    DBG("Taking burst");
+    unsigned long start = millis();
+    int taken = 0;
+    for (int i = 0; i < BURST_FRAMES; i++) {
+        FrameHandle frame = captureFrame();
+        if (!frame)
+            break;
+
+        char name[40];
+        frameName(name, sizeof(name));
+        // Copied, the camera buffer goes back at the end of the iteration
+        if (!burstPush(frame.fb(), frame.get()->takenMs, name))
+            break;
+        taken++;
+    }
 
-    return true;
+    if (taken > 0) {
+        burstStats.bursts++;
+        burstStats.burstMs = millis() - start;
+    }
+    DBG("Burst frames/ms:");
+    DBG(taken);
+    DBG(burstStats.burstMs);
+    return taken;
 }
@@ -0,0 +1,70 @@
+#include "esp_sntp.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include <sys/time.h>
+
+// Wall clock without blocking the capture path. SNTP runs in the background (it resyncs
+// on its own every hour), each sync caches the offset between esp_timer's monotonic
+// clock and UTC, and frame names are built from that.
+
+#define NTP_SERVER "pool.ntp.org"
+#define TIMEZONE "EST5EDT,M3.2.0,M11.1.0"
+
+int64_t clockOffsetUs = 0;  // UTC minus esp_timer_get_time(), 0 until the first sync
+portMUX_TYPE clockMux = portMUX_INITIALIZER_UNLOCKED;
+uint32_t nameSeq = 0;
+uint32_t bootId = 0;  // Keeps untimed names from different boots apart
+int cachedYday = -1;
+char cachedDay[12];   // "2024-05-31"
+
+// Runs on the SNTP task
+void clockSynced(struct timeval *tv) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t offset = (int64_t)now.tv_sec * 1000000 + now.tv_usec - esp_timer_get_time();
+
+    portENTER_CRITICAL(&clockMux);
+    clockOffsetUs = offset;
+    portEXIT_CRITICAL(&clockMux);
+}
+
+void clockInit() {
+    bootId = esp_random();
+    sntp_set_time_sync_notification_cb(clockSynced);
+    // Also sets TZ, configTime() would overwrite it with a plain UTC offset
+    configTzTime(TIMEZONE, NTP_SERVER);
+}
+
+bool clockValid() {
+    portENTER_CRITICAL(&clockMux);
+    bool valid = clockOffsetUs != 0;
+    portEXIT_CRITICAL(&clockMux);
+    return valid;
+}
+
+time_t clockNow() {
+    portENTER_CRITICAL(&clockMux);
+    int64_t offset = clockOffsetUs;
+    portEXIT_CRITICAL(&clockMux);
+    return (offset + esp_timer_get_time()) / 1000000;
+}
+
+// "2024-05-31/142501_17.jpg" - one remote folder per day so no directory listing grows
+// without bound, "untimed/<boot>_17.jpg" before the first sync
+void frameName(char *name, size_t size) {
+    nameSeq++;
+    if (!clockValid()) {
+        snprintf(name, size, "untimed/%08lx_%lu.jpg", (unsigned long)bootId, (unsigned long)nameSeq);
+        return;
+    }
+
+    time_t now = clockNow();
+    struct tm local;
+    localtime_r(&now, &local);
+    if (local.tm_yday != cachedYday) {
+        snprintf(cachedDay, sizeof(cachedDay), "%04d-%02d-%02d", local.tm_year + 1900, local.tm_mon + 1, local.tm_mday);
+        cachedYday = local.tm_yday;
+    }
+    snprintf(name, size, "%s/%02d%02d%02d_%lu.jpg", cachedDay, local.tm_hour, local.tm_min, local.tm_sec,
+             (unsigned long)nameSeq);
+}
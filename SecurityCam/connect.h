@@ -30,6 +30,10 @@ void wifiInit() {
 
 void wifiConnect() {
     DBG("\nConnecting to WiFi");
+#if defined(BURST_CARCOMMS)
+    WiFi.disconnect();  // Keeps the radio on, turning it off would take ESP-NOW down too
+#else
     WiFi.disconnect(true);
+#endif
     WiFi.begin(ssid, pass);
 }
@@ -0,0 +1,174 @@
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+
+// Camera frame buffers shared between the FTP uploader and the stream clients.
+// Nothing is copied, every consumer retains the same camera_fb_t and the last
+// release hands it back to the driver.
+
+// Here rather than in stream.h, the pool needs a buffer for each stream client: the published
+// frame, one older frame per slow client and the next capture are all out at once
+#define STREAM_MAX_CLIENTS 2
+#define CAMERA_FB_COUNT (2 + STREAM_MAX_CLIENTS)
+#define FRAME_POOL_SIZE CAMERA_FB_COUNT
+
+struct SharedFrame
+{
+    camera_fb_t *fb;  // NULL while the slot is free
+    uint8_t refs;
+    uint32_t seq;
+    unsigned long takenMs;
+};
+
+SharedFrame framePool[FRAME_POOL_SIZE];
+SharedFrame *latestFrame = NULL;  // Newest published frame, the pool holds one reference
+uint32_t frameSeq = 0;
+portMUX_TYPE frameMux = portMUX_INITIALIZER_UNLOCKED;
+uint8_t framesPeak = 0;  // Most slots ever in use at once
+
+// Takes over fb with one reference, NULL if every slot is in use (fb stays with the caller)
+SharedFrame *frameWrap(camera_fb_t *fb) {
+    SharedFrame *frame = NULL;
+    uint8_t used = 1;
+    portENTER_CRITICAL(&frameMux);
+    for (int i = 0; i < FRAME_POOL_SIZE; i++) {
+        if (framePool[i].fb) {
+            used++;
+        } else if (!frame) {
+            frame = &framePool[i];
+            frame->fb = fb;
+            frame->refs = 1;
+            frame->seq = ++frameSeq;
+            frame->takenMs = millis();
+        }
+    }
+    if (frame && used > framesPeak)
+        framesPeak = used;
+    portEXIT_CRITICAL(&frameMux);
+    return frame;
+}
+
+void frameRetain(SharedFrame *frame) {
+    portENTER_CRITICAL(&frameMux);
+    frame->refs++;
+    portEXIT_CRITICAL(&frameMux);
+}
+
+void frameRelease(SharedFrame *frame) {
+    camera_fb_t *fb = NULL;
+    portENTER_CRITICAL(&frameMux);
+    if (--frame->refs == 0) {
+        fb = frame->fb;
+        frame->fb = NULL;
+    }
+    portEXIT_CRITICAL(&frameMux);
+
+    // Outside the critical section, the driver takes a lock of its own
+    if (fb)
+        esp_camera_fb_return(fb);
+}
+
+// Makes frame the one frameLatest() hands out
+void framePublish(SharedFrame *frame) {
+    frameRetain(frame);
+    portENTER_CRITICAL(&frameMux);
+    SharedFrame *old = latestFrame;
+    latestFrame = frame;
+    portEXIT_CRITICAL(&frameMux);
+
+    if (old)
+        frameRelease(old);
+}
+
+// Drops the published frame, e.g. before the frame size changes
+void frameUnpublish() {
+    portENTER_CRITICAL(&frameMux);
+    SharedFrame *old = latestFrame;
+    latestFrame = NULL;
+    portEXIT_CRITICAL(&frameMux);
+
+    if (old)
+        frameRelease(old);
+}
+
+// Retained newest frame if it isn't seq, NULL otherwise
+SharedFrame *frameLatest(uint32_t seq) {
+    SharedFrame *frame = NULL;
+    portENTER_CRITICAL(&frameMux);
+    if (latestFrame && latestFrame->seq != seq) {
+        frame = latestFrame;
+        frame->refs++;
+    }
+    portEXIT_CRITICAL(&frameMux);
+    return frame;
+}
+
+uint8_t framesInUse() {
+    uint8_t used = 0;
+    portENTER_CRITICAL(&frameMux);
+    for (int i = 0; i < FRAME_POOL_SIZE; i++) {
+        if (framePool[i].fb)
+            used++;
+    }
+    portEXIT_CRITICAL(&frameMux);
+    return used;
+}
+
+// False while every camera buffer is held, esp_camera_fb_get() would block until one comes back
+bool frameAvailable() {
+    return framesInUse() < FRAME_POOL_SIZE;
+}
+
+// Owns one reference to a pool frame and releases it when it goes out of scope, so no
+// return path can forget to hand a camera buffer back. Copies retain, moves don't.
+class FrameHandle
+{
+    private:
+        SharedFrame *frame;
+
+    public:
+        FrameHandle() : frame(NULL) {}
+        explicit FrameHandle(SharedFrame *adopted) : frame(adopted) {}  // Takes over the caller's reference
+        FrameHandle(const FrameHandle &other) : frame(other.frame) {
+            if (frame)
+                frameRetain(frame);
+        }
+        FrameHandle(FrameHandle &&other) : frame(other.frame) { other.frame = NULL; }
+        ~FrameHandle() { reset(); }
+
+        FrameHandle &operator=(FrameHandle other) {
+            SharedFrame *old = frame;
+            frame = other.frame;
+            other.frame = old;  // Released by other's destructor
+            return *this;
+        }
+
+        // Wraps a fresh camera buffer, which goes straight back to the driver if the pool is full
+        static FrameHandle wrap(camera_fb_t *fb) {
+            if (!fb)
+                return FrameHandle();
+            SharedFrame *frame = frameWrap(fb);
+            if (!frame)
+                esp_camera_fb_return(fb);
+            return FrameHandle(frame);
+        }
+
+        // Retained newest published frame if it isn't seq, empty otherwise
+        static FrameHandle latest(uint32_t seq) { return FrameHandle(frameLatest(seq)); }
+
+        void reset() {
+            if (frame)
+                frameRelease(frame);
+            frame = NULL;
+        }
+
+        // Hands the reference to someone else, e.g. a queue item, without releasing it
+        SharedFrame *detach() {
+            SharedFrame *detached = frame;
+            frame = NULL;
+            return detached;
+        }
+
+        SharedFrame *get() const { return frame; }
+        camera_fb_t *fb() const { return frame ? frame->fb : NULL; }
+        explicit operator bool() const { return frame != NULL; }
+};
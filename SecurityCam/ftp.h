@@ -1,16 +1,276 @@
 #include "ESP32_FTPClient.h"
+#include "esp_camera.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "./backlog.h"
+#include "./framepool.h"
+#include "./burst.h"
+
+// Uploads run on their own task so loop() can capture the next frame meanwhile.
+// The job holds a reference to the frame, a stream client may be sending it at the same time.
+// Burst copies (burst.h) go out whenever no live frame is waiting.
+#define UPLOAD_QUEUE_LENGTH 1
+#define UPLOAD_TASK_STACK 8192
+#define UPLOAD_TASK_PRIORITY 1
+#define UPLOAD_TASK_WAKE 500  // ms, how often the task checks on the session and the backlog while idle
+#define UPLOAD_TEMP_SUFFIX ".part"
+#define FTP_KEEPALIVE_MS 20000  // NOOP after this long without a command, servers drop idle logins
 
 ESP32_FTPClient ftp(ftp_server, ftp_port, ftp_user, ftp_pass);
 
-void uploadFile(unsigned char *data, int length, const char *name) {
+struct UploadJob
+{
+    SharedFrame *frame;
+    unsigned long captureMs;  // Time spent in esp_camera_fb_get(), 0 for a frame taken from the stream
+    char name[40];
+};
+
+// Per-stage timings of the last upload, plus totals
+struct UploadStats
+{
+    unsigned long captureMs;
+    unsigned long connectMs;   // Reconnect/login, ~0 when the session was reused
+    unsigned long transferMs;  // TYPE/PASV/STOR, data and the final reply
+    unsigned long bytes;       // Sent by the last upload
+    unsigned long uploaded;
+    unsigned long failed;      // Went to the backlog
+    unsigned long dropped;     // Captured while the previous frame was still queued
+    unsigned long resumed;     // Uploads that continued a .part instead of starting over
+    unsigned long resumedBytes;
+    unsigned long incomplete;  // Server confirmed the transfer but SIZE disagreed
+    unsigned long latencyMs;   // Capture to confirmed upload, last frame
+    unsigned long latencyAvgMs;
+    unsigned long latencyMaxMs;
+};
+
+// One per uploaded live or burst frame, read by quality.h on loop(). Backlog uploads are
+// left out, they were taken at older settings and may be resumed halfway.
+struct UploadSample
+{
+    uint32_t jpegBytes;
+    uint32_t sentBytes;
+    uint32_t transferMs;
+};
+
+#define UPLOAD_SAMPLE_QUEUE_LENGTH 4
+
+UploadStats uploadStats;
+QueueHandle_t uploadQueue = NULL;
+QueueHandle_t sampleQueue = NULL;
+char remoteDay[16] = "";  // Day folder known to exist on the server, cleared when a STOR fails
+
+// Creates the folder in front of the name ("2024-05-31/..."), once per day instead of once per frame.
+// MakeDir() also succeeds on a 5xx reply, which is how most servers say the folder already
+// exists, but it can as well be missing with no rights to create it: a failed STOR clears
+// remoteDay so the next upload tries again.
+bool ensureRemoteDir(const char *name) {
+    const char *slash = strchr(name, '/');
+    if (!slash)
+        return true;
+
+    size_t length = slash - name;
+    if (length >= sizeof(remoteDay))
+        return false;
+    if (strncmp(remoteDay, name, length) == 0 && remoteDay[length] == 0)
+        return true;
+
+    char dir[sizeof(remoteDay)];
+    memcpy(dir, name, length);
+    dir[length] = 0;
+    if (!ftp.MakeDir(dir))
+        return false;
+
+    strcpy(remoteDay, dir);
+    return true;
+}
+
+// Goes up as <name>.part and is renamed once SIZE confirms all of it arrived, so
+// nothing watching the folder sees half a JPEG. With resume a .part left by an earlier
+// broken transfer is continued where it stopped (backlog frames keep their name).
+// Either data or file (a backlog frame on disk) supplies the bytes.
+bool uploadFile(const uint8_t *data, File *file, size_t length, const char *name, bool resume) {
     DBG("Uploading via FTP");
 
-    ftp.OpenConnection();
+    unsigned long start = millis();
+    if (!ftp.EnsureConnection()) {
+        DBG("FTP login failed");
+        return false;
+    }
+    unsigned long connected = millis();
+
+    char temp[48];
+    snprintf(temp, sizeof(temp), "%s" UPLOAD_TEMP_SUFFIX, name);
+
+    ftp.ChangeWorkDir(ftp_remote_dir);  // Skipped when the session is already there
+    if (!ensureRemoteDir(name)) {
+        DBG("FTP folder failed");
+        return false;  // Kept for the next try
+    }
+
+    size_t offset = 0;
+    if (resume) {
+        // SIZE needs binary mode, and has to come before PASV opens the data connection
+        ftp.SendCommand("TYPE I");
+        ftp.GetFTPAnswer();
+        long partial = ftp.GetFileSize(temp);
+        if (partial > 0 && (size_t)partial <= length)
+            offset = partial;
+    }
+
+    bool sent = true;
+    if (offset < length) {
+        ftp.InitFile("Type I");
+        if (offset > 0) {
+            ftp.ResumeFile(temp, offset);
+            uploadStats.resumed++;
+            uploadStats.resumedBytes += offset;
+        } else {
+            ftp.NewFile(temp);
+        }
 
-    ftp.InitFile("Type I");
-    ftp.ChangeWorkDir(ftp_remote_dir);
-    ftp.NewFile(name);
-    ftp.WriteData(data, length);
-    ftp.CloseFile();
+        if (file) {
+            file->seek(offset);
+            ftp.WriteData(backlogReadChunk, file);
+        } else {
+            ftp.WriteData((unsigned char *)data + offset, length - offset);
+        }
+        sent = ftp.CloseFile();
+        if (!sent)
+            remoteDay[0] = 0;  // Maybe the folder isn't there after all
+    }
+
+    // The 226 only says the data connection closed cleanly, SIZE says what actually landed
+    bool complete = sent && ftp.GetFileSize(temp) == (long)length;
+    if (sent && !complete)
+        uploadStats.incomplete++;
+    bool ok = complete && ftp.RenameFile(temp, name);
+
+    uploadStats.bytes = length - offset;
+    uploadStats.connectMs = connected - start;
+    uploadStats.transferMs = millis() - connected;
     DBG("");
+    return ok;
+}
+
+// Uploads the oldest backlog frame, false if it has to wait for the next try
+bool drainBacklog() {
+    BacklogEntry entry;
+    if (!backlogPeek(entry))
+        return false;
+
+    bool ok;
+    if (entry.data)
+        ok = uploadFile(entry.data, NULL, entry.size, entry.name, true);
+    else
+        ok = uploadFile(NULL, &entry.file, entry.size, entry.name, true);
+
+    if (!ok) {
+        if (!entry.data)
+            entry.file.close();
+        return false;
+    }
+    backlogPop(entry);
+
+    DBG("Backlog RAM/disk/age s:");
+    DBG(backlogStats.ramFrames);
+    DBG(backlogStats.diskFrames);
+    DBG(backlogOldestAge());
+    return true;
+}
+
+// Uploads a live or burst frame, or keeps it in the backlog if that fails
+void uploadFrame(const uint8_t *data, size_t length, const char *name, unsigned long takenMs) {
+    // A fresh name, there's no .part to look for
+    if (wifi_connected && uploadFile(data, NULL, length, name, false)) {
+        uploadStats.uploaded++;
+
+        UploadSample sample;
+        sample.jpegBytes = length;
+        sample.sentBytes = uploadStats.bytes;
+        sample.transferMs = uploadStats.transferMs;
+        xQueueSend(sampleQueue, &sample, 0);  // Dropped if loop() hasn't caught up, the next one will do
+
+        uploadStats.latencyMs = millis() - takenMs;
+        if (uploadStats.latencyMs > uploadStats.latencyMaxMs)
+            uploadStats.latencyMaxMs = uploadStats.latencyMs;
+        if (uploadStats.latencyAvgMs == 0)
+            uploadStats.latencyAvgMs = uploadStats.latencyMs;
+        else
+            uploadStats.latencyAvgMs += ((long)uploadStats.latencyMs - (long)uploadStats.latencyAvgMs) / 8;
+    } else {
+        // Kept for later instead of lost, the buffer goes back right away
+        uploadStats.failed++;
+        backlogPush(data, length, name);
+    }
+
+    DBG("Capture/connect/transfer/latency ms:");
+    DBG(uploadStats.captureMs);
+    DBG(uploadStats.connectMs);
+    DBG(uploadStats.transferMs);
+    DBG(uploadStats.latencyMs);
+    DBG("Frames in use/peak, burst waiting/peak:");
+    DBG(framesInUse());
+    DBG(framesPeak);
+    DBG(burstPending());
+    DBG(burstStats.pendingPeak);
+}
+
+void uploadTask(void *arg) {
+    UploadJob job;
+    BurstFrame burst;
+    unsigned long drainTimer = 0;
+    for (;;) {
+        // Wakes up regularly to keep the FTP session alive and drain the backlog between frames,
+        // doesn't wait at all while burst frames are queued
+        TickType_t wait = burstPending() > 0 ? 0 : pdMS_TO_TICKS(UPLOAD_TASK_WAKE);
+        if (xQueueReceive(uploadQueue, &job, wait) == pdTRUE) {
+            FrameHandle frame(job.frame);  // Released once uploaded or copied to the backlog
+            uploadStats.captureMs = job.captureMs;
+            uploadFrame(frame.fb()->buf, frame.fb()->len, job.name, frame.get()->takenMs);
+        } else if (burstNext(burst)) {
+            uploadStats.captureMs = 0;
+            uploadFrame(burst.data, burst.size, burst.name, burst.takenMs);
+            burstFree(burst);
+            continue;  // The backlog can wait until the burst is out
+        }
+
+        if (!wifi_connected)
+            continue;
+
+        if (backlogEmpty()) {
+            ftp.KeepAlive(FTP_KEEPALIVE_MS);
+        } else if (millis() - drainTimer >= BACKLOG_DRAIN_INTERVAL) {
+            drainTimer = millis();
+            drainBacklog();
+        }
+    }
+}
+
+void uploadInit() {
+    backlogInit();
+    uploadQueue = xQueueCreate(UPLOAD_QUEUE_LENGTH, sizeof(UploadJob));
+    sampleQueue = xQueueCreate(UPLOAD_SAMPLE_QUEUE_LENGTH, sizeof(UploadSample));
+    xTaskCreate(uploadTask, "ftp_upload", UPLOAD_TASK_STACK, NULL, UPLOAD_TASK_PRIORITY, NULL);
+}
+
+// False if the last frame is still waiting, capturing now would only hold a frame buffer
+bool uploadReady() {
+    return uploadQueue && uxQueueSpacesAvailable(uploadQueue) > 0;
+}
+
+// Takes the frame out of the handle once it is queued, the upload task releases it
+bool queueUpload(FrameHandle &frame, unsigned long captureMs, const char *name) {
+    UploadJob job;
+    job.frame = frame.get();
+    job.captureMs = captureMs;
+    strncpy(job.name, name, sizeof(job.name) - 1);
+    job.name[sizeof(job.name) - 1] = 0;
+
+    if (xQueueSend(uploadQueue, &job, 0) != pdTRUE) {
+        uploadStats.dropped++;
+        return false;
+    }
+    frame.detach();
+    return true;
 }
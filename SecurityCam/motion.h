@@ -0,0 +1,141 @@
+// Motion gating: between uploads the sensor runs at PROBE_FRAMESIZE, each probe frame
+// is decoded to grayscale and compared block by block against a running background.
+// Only when enough blocks changed does loop() switch to full size and upload a picture.
+
+#define PROBE_FRAMESIZE FRAMESIZE_QQVGA
+#define PROBE_WIDTH 160
+#define PROBE_HEIGHT 120
+
+#define MOTION_INTERVAL 500      // ms between probes
+#define MOTION_BLOCK 8           // Block size in probe pixels, 20x15 blocks at QQVGA
+#define MOTION_BLOCK_THRESHOLD 12 // Mean abs difference per pixel (0-255) for a block to count as changed
+#define MOTION_MIN_BLOCKS 3      // Changed blocks needed to trigger
+#define MOTION_BG_SHIFT 3        // Background follows each probe by 1/8, slow light changes fade in
+
+#define MOTION_BLOCKS_X (PROBE_WIDTH / MOTION_BLOCK)
+#define MOTION_BLOCKS_Y (PROBE_HEIGHT / MOTION_BLOCK)
+
+struct MotionStats
+{
+    unsigned long probes;
+    unsigned long skipped;    // Probes without motion, nothing uploaded
+    unsigned long triggered;  // Probes with motion
+    unsigned long sent;       // Pictures queued after motion
+    unsigned long probeMs;    // Grab + decode + compare of the last probe
+    uint16_t changedBlocks;   // Of the last probe
+};
+
+MotionStats motionStats;
+unsigned long motion_timer = 0;
+
+uint8_t *probe_rgb = NULL;   // Decoded probe frame, RGB565
+uint16_t *background = NULL; // Gray << 4, the extra bits let small changes accumulate
+bool background_ok = false;
+
+bool motionInit() {
+    if (probe_rgb)
+        return true;
+
+    // PSRAM when there is some, the camera frame buffers are there anyway
+    probe_rgb = (uint8_t *)ps_malloc(PROBE_WIDTH * PROBE_HEIGHT * 2);
+    background = (uint16_t *)ps_malloc(PROBE_WIDTH * PROBE_HEIGHT * sizeof(uint16_t));
+    if (!probe_rgb || !background) {
+        DBG("Motion buffers failed");
+        free(probe_rgb);
+        free(background);
+        probe_rgb = NULL;
+        background = NULL;
+        return false;
+    }
+    return true;
+}
+
+// jpg2rgb565 writes each pixel high byte first
+inline uint8_t rgb565Gray(const uint8_t *px) {
+    uint8_t r = px[0] >> 3;
+    uint8_t g = ((px[0] & 0x07) << 3) | (px[1] >> 5);
+    uint8_t b = px[1] & 0x1F;
+    // 0.30 R + 0.59 G + 0.11 B, scaled from 5/6/5 bits
+    return (r * 616 + g * 600 + b * 232) >> 8;
+}
+
+// SAD of one block against the background, updating the background in the same pass
+uint32_t blockSad(const uint8_t *rgb, uint16_t *bg) {
+    uint32_t sad = 0;
+    for (int y = 0; y < MOTION_BLOCK; y++) {
+        const uint8_t *px = rgb + y * PROBE_WIDTH * 2;
+        uint16_t *b = bg + y * PROBE_WIDTH;
+        for (int x = 0; x < MOTION_BLOCK; x++) {
+            int gray = rgb565Gray(px) << 4;
+            int diff = gray - b[x];
+            sad += (diff < 0 ? -diff : diff) >> 4;
+            b[x] += diff >> MOTION_BG_SHIFT;
+            px += 2;
+        }
+    }
+    return sad;
+}
+
+uint16_t compareBackground() {
+    uint16_t changed = 0;
+    for (int by = 0; by < MOTION_BLOCKS_Y; by++) {
+        for (int bx = 0; bx < MOTION_BLOCKS_X; bx++) {
+            int offset = by * MOTION_BLOCK * PROBE_WIDTH + bx * MOTION_BLOCK;
+            if (blockSad(probe_rgb + offset * 2, background + offset) > MOTION_BLOCK_THRESHOLD * MOTION_BLOCK * MOTION_BLOCK)
+                changed++;
+        }
+    }
+    return changed;
+}
+
+void resetBackground() {
+    for (int i = 0; i < PROBE_WIDTH * PROBE_HEIGHT; i++)
+        background[i] = rgb565Gray(probe_rgb + i * 2) << 4;
+    background_ok = true;
+}
+
+// Takes a small probe frame, true if the scene changed since the last probes
+bool motionDetected() {
+    if (!motionInit())
+        return true;  // Can't tell, fall back to uploading every interval
+
+    unsigned long start = millis();
+    if (!frameAvailable())
+        return false;
+    cameraSetFrameSize(PROBE_FRAMESIZE);
+    FrameHandle probe = FrameHandle::wrap(grabFrame());
+    if (!probe) {
+        DBG("Probe capture failed");
+        return false;
+    }
+
+    // Still JPEG (switching the pixel format needs a camera reinit), but a QQVGA frame decodes in a few ms
+    bool decoded = jpg2rgb565(probe.fb()->buf, probe.fb()->len, probe_rgb, JPG_SCALE_NONE);
+    probe.reset();
+    if (!decoded) {
+        DBG("Probe decode failed");
+        return false;
+    }
+
+    motionStats.probes++;
+    if (!background_ok) {
+        resetBackground();
+        motionStats.changedBlocks = 0;
+        motionStats.probeMs = millis() - start;
+        motionStats.skipped++;
+        return false;
+    }
+
+    motionStats.changedBlocks = compareBackground();
+    motionStats.probeMs = millis() - start;
+
+    if (motionStats.changedBlocks < MOTION_MIN_BLOCKS) {
+        motionStats.skipped++;
+        return false;
+    }
+
+    motionStats.triggered++;
+    DBG("Motion, changed blocks:");
+    DBG(motionStats.changedBlocks);
+    return true;
+}
@@ -0,0 +1,112 @@
+// Adaptive JPEG quality: keeps the average picture inside what the link can move
+// in a share of SEND_INTERVAL. Too big -> raise jpeg_quality (worse), at the worst
+// quality step the frame size down. Room to spare -> the same in reverse.
+// The hysteresis band and a hold after every change keep it from flapping.
+
+//#define QUALITY_BENCHMARK  // CSV per upload on Serial: bytes,quality,width,transfer ms,bytes/s
+
+#define QUALITY_LINK_SHARE 50       // % of SEND_INTERVAL an upload may take
+#define QUALITY_MAX_BYTES 250000    // Budget cap even on a fast link
+#define QUALITY_HYSTERESIS 20       // % around the budget where nothing changes
+#define QUALITY_HOLD_FRAMES 3       // Uploads at a new setting before judging it
+#define QUALITY_BEST 10
+#define QUALITY_WORST 40
+#define QUALITY_STEP 4
+
+// Step-down order, the first one has to be CAPTURE_FRAMESIZE
+const framesize_t qualitySizes[] = { FRAMESIZE_UXGA, FRAMESIZE_SXGA, FRAMESIZE_XGA, FRAMESIZE_SVGA, FRAMESIZE_VGA };
+#define QUALITY_SIZES (sizeof(qualitySizes) / sizeof(qualitySizes[0]))
+
+struct QualityState
+{
+    int quality;
+    uint8_t sizeIndex;
+    uint32_t avgBytes;       // Picture size at the current setting, 0 until the first one
+    uint32_t bytesPerSec;    // Upload throughput, 0 until the first upload
+    uint8_t held;            // Uploads since the last change
+    unsigned long changes;
+};
+
+QualityState qualityState = { JPEG_QUALITY, 0, 0, 0, 0, 0 };
+
+uint32_t qualityBudget() {
+    uint32_t budget = QUALITY_MAX_BYTES;
+    if (qualityState.bytesPerSec > 0) {
+        uint64_t link = (uint64_t)qualityState.bytesPerSec * SEND_INTERVAL * QUALITY_LINK_SHARE / 100000;
+        if (link < budget)
+            budget = link;
+    }
+    return budget;
+}
+
+void qualityApply() {
+    sensor_t *s = esp_camera_sensor_get();
+    s->set_quality(s, qualityState.quality);
+    capture_framesize = qualitySizes[qualityState.sizeIndex];  // Picked up by the next capture
+
+    qualityState.avgBytes = 0;
+    qualityState.held = 0;
+    qualityState.changes++;
+    DBG("JPEG quality/size:");
+    DBG(qualityState.quality);
+    DBG(resolution[capture_framesize].width);
+}
+
+void qualityJudge(size_t bytes) {
+    // Smoothed over ~4 frames, scenes vary a lot from frame to frame
+    if (qualityState.avgBytes == 0)
+        qualityState.avgBytes = bytes;
+    else
+        qualityState.avgBytes += ((int32_t)bytes - (int32_t)qualityState.avgBytes) / 4;
+
+    if (qualityState.held < QUALITY_HOLD_FRAMES) {
+        qualityState.held++;
+        return;
+    }
+
+    uint32_t budget = qualityBudget();
+    uint32_t high = budget / 100 * (100 + QUALITY_HYSTERESIS);
+    uint32_t low = budget / 100 * (100 - QUALITY_HYSTERESIS);
+
+    if (qualityState.avgBytes > high) {
+        if (qualityState.quality < QUALITY_WORST) {
+            qualityState.quality = min(qualityState.quality + QUALITY_STEP, QUALITY_WORST);
+            qualityApply();
+        } else if (qualityState.sizeIndex + 1u < QUALITY_SIZES) {
+            // A smaller picture at the default quality looks better than a big one at the worst
+            qualityState.sizeIndex++;
+            qualityState.quality = JPEG_QUALITY;
+            qualityApply();
+        }
+    } else if (qualityState.avgBytes < low) {
+        if (qualityState.sizeIndex > 0 && qualityState.avgBytes * 2 < low) {
+            // The next size up has roughly 1.5-2x the pixels
+            qualityState.sizeIndex--;
+            qualityState.quality = QUALITY_WORST;
+            qualityApply();
+        } else if (qualityState.quality > QUALITY_BEST) {
+            qualityState.quality = max(qualityState.quality - QUALITY_STEP, QUALITY_BEST);
+            qualityApply();
+        }
+    }
+}
+
+// Picks up finished live uploads (their size and throughput) and adjusts, call from loop()
+void qualityUpdate() {
+    UploadSample sample;
+    while (xQueueReceive(sampleQueue, &sample, 0) == pdTRUE) {
+        uint32_t ms = sample.transferMs > 0 ? sample.transferMs : 1;
+        uint32_t bytesPerSec = (uint64_t)sample.sentBytes * 1000 / ms;
+        if (qualityState.bytesPerSec == 0)
+            qualityState.bytesPerSec = bytesPerSec;
+        else
+            qualityState.bytesPerSec += ((int32_t)bytesPerSec - (int32_t)qualityState.bytesPerSec) / 4;
+
+#if defined(QUALITY_BENCHMARK)
+        Serial.printf("%lu,%d,%u,%lu,%lu\n", (unsigned long)sample.jpegBytes, qualityState.quality,
+                      resolution[capture_framesize].width, (unsigned long)sample.transferMs, (unsigned long)bytesPerSec);
+#endif
+
+        qualityJudge(sample.jpegBytes);
+    }
+}
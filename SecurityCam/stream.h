@@ -0,0 +1,171 @@
+#include <WiFi.h>
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+// MJPEG live view on http://<cam>:81/, the camera's own JPEGs sent as they are.
+// Each client has a task that always sends the newest published frame, so a slow
+// client just skips frames instead of queueing them up - its frame rate adapts on its own.
+
+#define STREAM_PORT 81
+// STREAM_MAX_CLIENTS is in framepool.h
+#define STREAM_MAX_FPS 10        // Capture rate while anyone is watching
+#define STREAM_TASK_STACK 4096
+#define STREAM_TASK_PRIORITY 1
+#define STREAM_ACCEPT_INTERVAL 100
+#define STREAM_BOUNDARY "frame"
+
+struct StreamStats
+{
+    unsigned long clientsServed;
+    unsigned long framesSent;
+    unsigned long lastClientFps10;  // Average frame rate * 10 of the last client that left
+};
+
+WiFiServer streamServer(STREAM_PORT);
+TaskHandle_t streamTasks[STREAM_MAX_CLIENTS];
+volatile uint8_t streamClients = 0;
+StreamStats streamStats;
+unsigned long stream_timer = 0;
+SemaphoreHandle_t streamLock = NULL;  // Guards streamTasks, a task is only deleted after leaving it
+
+// Skips the request, any path streams
+bool streamReadRequest(WiFiClient *client) {
+    client->setTimeout(2);  // s
+    for (;;) {
+        String line = client->readStringUntil('\n');
+        if (line.length() == 0)
+            return false;  // Timed out or closed
+        if (line == "\r")
+            return true;
+    }
+}
+
+bool streamSendFrame(WiFiClient *client, SharedFrame *frame) {
+    char part[96];
+    int partLength = snprintf(part, sizeof(part),
+                              "--" STREAM_BOUNDARY "\r\nContent-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n",
+                              (unsigned)frame->fb->len);
+    if (client->write((const uint8_t *)part, partLength) != (size_t)partLength)
+        return false;
+    // Straight from the camera buffer, no copy per client
+    if (client->write(frame->fb->buf, frame->fb->len) != frame->fb->len)
+        return false;
+    return client->write((const uint8_t *)"\r\n", 2) == 2;
+}
+
+void streamClientTask(void *arg) {
+    WiFiClient *client = (WiFiClient *)arg;
+    unsigned long start = millis();
+    unsigned long frames = 0;
+
+    if (streamReadRequest(client)) {
+        client->print("HTTP/1.1 200 OK\r\n"
+                      "Content-Type: multipart/x-mixed-replace;boundary=" STREAM_BOUNDARY "\r\n"
+                      "Cache-Control: no-cache\r\n"
+                      "Access-Control-Allow-Origin: *\r\n\r\n");
+
+        uint32_t lastSeq = 0;
+        while (client->connected()) {
+            // Woken by streamPublish(), the timeout only notices a dead client
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+
+            FrameHandle frame = FrameHandle::latest(lastSeq);
+            if (!frame)
+                continue;
+
+            lastSeq = frame.get()->seq;
+            if (!streamSendFrame(client, frame.get()))
+                break;
+            frames++;
+        }
+    }
+
+    unsigned long elapsed = millis() - start;
+    client->stop();
+    delete client;
+
+    xSemaphoreTake(streamLock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (streamTasks[i] == xTaskGetCurrentTaskHandle())
+            streamTasks[i] = NULL;
+    }
+    streamClients--;
+    streamStats.framesSent += frames;
+    if (elapsed > 0)
+        streamStats.lastClientFps10 = frames * 10000 / elapsed;
+    xSemaphoreGive(streamLock);
+
+    DBG("Stream client left, fps x10:");
+    DBG(streamStats.lastClientFps10);
+    vTaskDelete(NULL);
+}
+
+void streamAcceptTask(void *arg) {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(STREAM_ACCEPT_INTERVAL));
+
+        WiFiClient incoming = streamServer.available();
+        if (!incoming)
+            continue;
+
+        if (streamClients >= STREAM_MAX_CLIENTS) {
+            incoming.print("HTTP/1.1 503 Service Unavailable\r\nRetry-After: 5\r\n\r\n");
+            incoming.stop();
+            continue;
+        }
+
+        WiFiClient *client = new WiFiClient(incoming);
+        client->setNoDelay(true);
+
+        // Held until the handle is stored, the task can't finish and clear its slot before that
+        xSemaphoreTake(streamLock, portMAX_DELAY);
+        int slot = 0;
+        while (streamTasks[slot])
+            slot++;
+        if (xTaskCreate(streamClientTask, "stream", STREAM_TASK_STACK, client, STREAM_TASK_PRIORITY, &streamTasks[slot]) == pdPASS) {
+            streamClients++;
+            streamStats.clientsServed++;
+        } else {
+            streamTasks[slot] = NULL;
+            client->stop();
+            delete client;
+        }
+        xSemaphoreGive(streamLock);
+    }
+}
+
+void streamInit() {
+    streamLock = xSemaphoreCreateMutex();
+    streamServer.begin();
+    xTaskCreate(streamAcceptTask, "stream_accept", 3072, NULL, STREAM_TASK_PRIORITY, NULL);
+}
+
+bool streamActive() {
+    return streamClients > 0;
+}
+
+// Captures and publishes a frame at up to STREAM_MAX_FPS while anyone is watching, call from loop()
+void streamPublish() {
+    if (!streamActive()) {
+        // Don't keep a camera buffer for nobody
+        frameUnpublish();
+        return;
+    }
+
+    unsigned long now = millis();
+    if (now - stream_timer < 1000 / STREAM_MAX_FPS)
+        return;
+    stream_timer = now;
+
+    FrameHandle frame = captureFrame();
+    if (!frame)
+        return;
+    framePublish(frame.get());
+
+    xSemaphoreTake(streamLock, portMAX_DELAY);
+    for (int i = 0; i < STREAM_MAX_CLIENTS; i++) {
+        if (streamTasks[i])
+            xTaskNotifyGive(streamTasks[i]);
+    }
+    xSemaphoreGive(streamLock);
+}
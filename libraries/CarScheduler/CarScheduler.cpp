@@ -0,0 +1,134 @@
+#include "CarScheduler.h"
+
+
+CarScheduler::CarScheduler()
+{
+    memset(tasks, 0, sizeof(tasks));
+}
+
+TaskHandle CarScheduler::add(uint32_t delayMS, uint32_t periodMS, TaskCallback callback, void* arg)
+{
+    if (!callback)
+        return INVALID_TASK;
+
+    for (uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+    {
+        Task* task = &tasks[i];
+        if (task->callback)
+            continue;
+
+        task->callback = callback;
+        task->arg = arg;
+        task->deadlineMS = millis() + delayMS;
+        task->periodMS = periodMS;
+        return (TaskHandle)((task->generation << 8) | (i + 1));
+    }
+
+    return INVALID_TASK;
+}
+
+CarScheduler::Task* CarScheduler::get(TaskHandle handle)
+{
+    uint8_t slot = handle & 0xFF;
+    if (slot == 0 || slot > SCHEDULER_MAX_TASKS)
+        return nullptr;
+
+    Task* task = &tasks[slot - 1];
+    if (!task->callback || task->generation != (handle >> 8))
+        return nullptr;
+
+    return task;
+}
+
+void CarScheduler::release(Task* task)
+{
+    task->callback = nullptr;
+    task->generation++; // Invalidates any handles still pointing at this slot
+}
+
+TaskHandle CarScheduler::once(uint32_t delayMS, TaskCallback callback, void* arg)
+{
+    return add(delayMS, 0, callback, arg);
+}
+
+TaskHandle CarScheduler::every(uint32_t periodMS, TaskCallback callback, void* arg)
+{
+    // A period of 0 would spin every loop(), and would look like a one-shot anyways
+    return add(periodMS, periodMS == 0 ? 1 : periodMS, callback, arg);
+}
+
+bool CarScheduler::cancel(TaskHandle& handle)
+{
+    Task* task = get(handle);
+    handle = INVALID_TASK;
+
+    if (!task)
+        return false;
+
+    release(task);
+    return true;
+}
+
+bool CarScheduler::isPending(TaskHandle handle)
+{
+    return get(handle) != nullptr;
+}
+
+uint32_t CarScheduler::getRemainingMS(TaskHandle handle)
+{
+    Task* task = get(handle);
+    if (!task)
+        return 0;
+
+    uint32_t now = millis();
+    return hasElapsed(task->deadlineMS, now) ? 0 : task->deadlineMS - now;
+}
+
+void CarScheduler::setRenderHandler(TaskCallback callback, void* arg, uint16_t frameMS)
+{
+    renderCallback = callback;
+    renderArg = arg;
+    this->frameMS = frameMS;
+    lastRenderMS = millis() - frameMS; // First request renders straight away
+}
+
+void CarScheduler::requestRender()
+{
+    renderRequested = true;
+}
+
+void CarScheduler::loop()
+{
+    uint32_t now = millis();
+
+    for (uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++)
+    {
+        Task* task = &tasks[i];
+        if (!task->callback || !hasElapsed(task->deadlineMS, now))
+            continue;
+
+        // Copy out first - the callback is free to cancel or reuse its own slot
+        TaskCallback callback = task->callback;
+        void* arg = task->arg;
+
+        if (task->periodMS != 0)
+        {
+            task->deadlineMS += task->periodMS;
+            // Don't try to catch up on runs we missed while something blocked
+            if (hasElapsed(task->deadlineMS, now))
+                task->deadlineMS = now + task->periodMS;
+        }
+        else
+            release(task);
+
+        callback(arg);
+    }
+
+    if (renderRequested && renderCallback && hasElapsed(lastRenderMS + frameMS, now))
+    {
+        // Clear before rendering so a request made during the render is kept for next frame
+        renderRequested = false;
+        lastRenderMS = now;
+        renderCallback(renderArg);
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef CARSCHEDULER_H
+#define CARSCHEDULER_H
+
+/*
+
+Cooperative timers for the car modules
+One-shot and periodic jobs run from loop(), never from an interrupt or the ESP-NOW callback
+Deadlines are compared as (now - deadline) so they survive millis() wrapping around
+
+Display refreshes go through requestRender() - any number of requests in a frame cause one render
+
+*/
+
+#include <Arduino.h>
+
+#define SCHEDULER_MAX_TASKS 8
+#define SCHEDULER_DEFAULT_FRAME_MS 33 // ~30 fps
+
+// Low byte is the slot (+1 so 0 is never valid), high byte is the slot's generation
+// A stale handle (task already ran or was cancelled) won't touch whatever reused the slot
+typedef uint16_t TaskHandle;
+#define INVALID_TASK 0
+
+typedef void (*TaskCallback)(void* arg);
+
+
+class CarScheduler
+{
+    private:
+        struct Task
+        {
+            TaskCallback callback; // nullptr when the slot is free
+            void* arg;
+            uint32_t deadlineMS;
+            uint32_t periodMS; // 0 for one-shots
+            uint8_t generation;
+        };
+
+        Task tasks[SCHEDULER_MAX_TASKS];
+
+        TaskCallback renderCallback = nullptr;
+        void* renderArg = nullptr;
+        uint16_t frameMS = SCHEDULER_DEFAULT_FRAME_MS;
+        uint32_t lastRenderMS = 0;
+        bool renderRequested = false;
+
+        TaskHandle add(uint32_t delayMS, uint32_t periodMS, TaskCallback callback, void* arg);
+        Task* get(TaskHandle handle);
+        void release(Task* task);
+
+    public:
+        CarScheduler();
+
+        TaskHandle once(uint32_t delayMS, TaskCallback callback, void* arg = nullptr); // Returns INVALID_TASK if all slots are in use
+        TaskHandle every(uint32_t periodMS, TaskCallback callback, void* arg = nullptr);
+        bool cancel(TaskHandle& handle); // Clears the handle, returns false if it had already run/been cancelled
+        bool isPending(TaskHandle handle);
+        uint32_t getRemainingMS(TaskHandle handle); // 0 if not pending
+
+        void setRenderHandler(TaskCallback callback, void* arg = nullptr, uint16_t frameMS = SCHEDULER_DEFAULT_FRAME_MS);
+        void requestRender();
+        void loop();
+
+        static bool hasElapsed(uint32_t deadlineMS, uint32_t nowMS) { return (int32_t)(nowMS - deadlineMS) >= 0; }
+};
+
+#endif // ifndef CARSCHEDULER_H
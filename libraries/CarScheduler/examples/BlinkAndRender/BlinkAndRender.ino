@@ -0,0 +1,43 @@
+#include "CarScheduler.h"
+
+CarScheduler scheduler;
+TaskHandle timeoutTask;
+int updates = 0;
+
+void setup() {
+  Serial.begin(115200);
+  pinMode(LED_BUILTIN, OUTPUT);
+
+  // Periodic job
+  scheduler.every(500, blink);
+  // Renders at most every 100ms, no matter how often requestRender() is called
+  scheduler.setRenderHandler(render, nullptr, 100);
+  // One-shot that gets pushed back every time something arrives
+  timeoutTask = scheduler.once(5000, timeout);
+}
+
+void blink(void* arg) {
+  digitalWrite(LED_BUILTIN, !digitalRead(LED_BUILTIN));
+}
+
+void render(void* arg) {
+  Serial.print("Render, updates so far: ");
+  Serial.println(updates);
+}
+
+void timeout(void* arg) {
+  Serial.println("Nothing received for 5 seconds");
+}
+
+void loop() {
+  scheduler.loop();
+
+  if (Serial.available()) {
+    Serial.read();
+    updates++;
+    scheduler.requestRender();  // A burst of these still only renders once per frame
+
+    scheduler.cancel(timeoutTask);
+    timeoutTask = scheduler.once(5000, timeout);
+  }
+}
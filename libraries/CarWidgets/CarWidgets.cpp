@@ -0,0 +1,225 @@
+#include "CarWidgets.h"
+
+CarWidgets::CarWidgets(U8G2& u8g2, const Widget* widgets, WidgetState* state, uint8_t count)
+    : u8g2(u8g2), widgets(widgets), state(state), count(count)
+{
+}
+
+int32_t CarWidgets::read(const Widget& widget, const void* msg)
+{
+    // The message can be a raw receive buffer, so go through memcpy instead of casting the pointer
+    const uint8_t* field = (const uint8_t*)msg + widget.offset;
+    switch (widget.valueType)
+    {
+        case WIDGET_VALUE_BOOL: { bool v; memcpy(&v, field, sizeof(v)); return v; }
+        case WIDGET_VALUE_U8: { uint8_t v; memcpy(&v, field, sizeof(v)); return v; }
+        case WIDGET_VALUE_U16: { uint16_t v; memcpy(&v, field, sizeof(v)); return v; }
+        case WIDGET_VALUE_I16: { int16_t v; memcpy(&v, field, sizeof(v)); return v; }
+        case WIDGET_VALUE_U32: { uint32_t v; memcpy(&v, field, sizeof(v)); return (int32_t)v; }
+        case WIDGET_VALUE_I32: { int32_t v; memcpy(&v, field, sizeof(v)); return v; }
+        case WIDGET_VALUE_FLOAT:
+        {
+            float v;
+            memcpy(&v, field, sizeof(v));
+            return U8G2::toFixed(v, widget.decimals);
+        }
+        default:
+            return 0;
+    }
+}
+
+// zeroText is for a field that is really 0 (no data yet), not one that rounds to 0
+bool CarWidgets::isZero(const Widget& widget, const void* msg)
+{
+    if (widget.valueType != WIDGET_VALUE_FLOAT)
+        return read(widget, msg) == 0;
+
+    float v;
+    memcpy(&v, (const uint8_t*)msg + widget.offset, sizeof(v));
+    return v == 0.0f;
+}
+
+int32_t CarWidgets::key(const Widget& widget, int32_t value)
+{
+    switch (widget.type)
+    {
+        case WIDGET_TYPE_NUMBER:
+            return value;
+        case WIDGET_TYPE_ICON:
+        case WIDGET_TYPE_BITMAP:
+            return widget.valueType == WIDGET_VALUE_NONE || value != 0;
+        case WIDGET_TYPE_BAR:
+        {
+            // Filled width inside the 1px frame
+            if (widget.max <= widget.min || value <= widget.min)
+                return 0;
+            if (value >= widget.max)
+                return widget.w - 2;
+            return (int32_t)((int64_t)(value - widget.min) * (widget.w - 2) / (widget.max - widget.min));
+        }
+        default:
+            return 0;
+    }
+}
+
+CarWidgets::Box CarWidgets::bounds(const Widget& widget, const WidgetState& shown)
+{
+    Box box = { widget.x, widget.y, widget.w, widget.h };
+    if (widget.type == WIDGET_TYPE_BITMAP)
+    {
+        box.w = u8g2_GetCompiledBitmapWidth((const uint8_t*)widget.data);
+        box.h = u8g2_GetCompiledBitmapHeight((const uint8_t*)widget.data);
+    }
+    if (widget.type == WIDGET_TYPE_LABEL || widget.type == WIDGET_TYPE_NUMBER)
+    {
+        // Font bounding box, covers every glyph of the font
+        u8g2.setFont(widget.font);
+        const u8g2_t* u8g2_ = u8g2.getU8g2();
+        box.h = u8g2_->font_info.max_char_height;
+        box.y = widget.y - (box.h + u8g2_->font_info.y_offset);
+        if (widget.type == WIDGET_TYPE_LABEL)
+            box.w = u8g2.getStrWidth((const char*)widget.data);
+        else
+        {
+            // A value wider than w is still cleared completely when it shrinks
+            if (shown.width > box.w)
+                box.w = shown.width;
+            box.x = widget.x - box.w;
+        }
+    }
+    return box;
+}
+
+void CarWidgets::clear(const Box& box)
+{
+    u8g2.setDrawColor(0);
+    u8g2.drawBox(box.x, box.y, box.w, box.h);
+    u8g2.setDrawColor(1);
+}
+
+u8g2_uint_t CarWidgets::draw(const Widget& widget, int32_t value, bool zero)
+{
+    switch (widget.type)
+    {
+        case WIDGET_TYPE_LABEL:
+            u8g2.setFont(widget.font);
+            u8g2.drawStr(widget.x, widget.y, (const char*)widget.data);
+            break;
+
+        case WIDGET_TYPE_NUMBER:
+        {
+            char buf[WIDGET_TEXT_MAX];
+            const char* text = buf;
+            if (zero && widget.zeroText)
+                text = widget.zeroText;
+            else
+            {
+                uint8_t len = formatFixed(buf, value, widget.decimals);
+                if (widget.suffix)
+                {
+                    strncpy(buf + len, widget.suffix, sizeof(buf) - len - 1);
+                    buf[sizeof(buf) - 1] = 0;
+                }
+            }
+            u8g2.setFont(widget.font);
+            u8g2_uint_t width = u8g2.getStrWidth(text);
+            u8g2.drawStr(widget.x - width, widget.y, text);
+            return width;
+        }
+
+        case WIDGET_TYPE_ICON:
+            if (key(widget, value))
+                u8g2.drawXBMP(widget.x, widget.y, widget.w, widget.h, (const uint8_t*)widget.data);
+            break;
+
+        case WIDGET_TYPE_BITMAP:
+            if (key(widget, value))
+                u8g2.drawCompiledBitmap(widget.x, widget.y, (const uint8_t*)widget.data);
+            break;
+
+        case WIDGET_TYPE_BAR:
+        {
+            u8g2.drawFrame(widget.x, widget.y, widget.w, widget.h);
+            int32_t filled = key(widget, value);
+            if (filled > 0)
+                u8g2.drawBox(widget.x + 1, widget.y + 1, filled, widget.h - 2);
+            break;
+        }
+    }
+    return 0;
+}
+
+void CarWidgets::redrawOverlapping(const Box& box)
+{
+    // Font boxes are generous - a cleared readout can reach into a label next to it
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const Widget& widget = widgets[i];
+        if (widget.valueType != WIDGET_VALUE_NONE)
+            continue;
+
+        Box other = bounds(widget, state[i]);
+        if (other.x < box.x + box.w && box.x < other.x + other.w &&
+            other.y < box.y + box.h && box.y < other.y + other.h)
+            draw(widget, 0);
+    }
+}
+
+bool CarWidgets::update(const void* msg)
+{
+    if (!drawn)
+    {
+        u8g2.clearBuffer();
+        u8g2.setDrawColor(1);
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (widgets[i].valueType == WIDGET_VALUE_NONE)
+                continue;
+            int32_t value = read(widgets[i], msg);
+            state[i].key = key(widgets[i], value);
+            state[i].zero = isZero(widgets[i], msg);
+            state[i].width = draw(widgets[i], value, state[i].zero);
+        }
+        // Static widgets last, same as redrawOverlapping() they go over the values
+        for (uint8_t i = 0; i < count; i++)
+        {
+            if (widgets[i].valueType == WIDGET_VALUE_NONE)
+                draw(widgets[i], 0);
+        }
+        drawn = true;
+        return true;
+    }
+
+    bool changed = false;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const Widget& widget = widgets[i];
+        if (widget.valueType == WIDGET_VALUE_NONE)
+            continue;
+
+        int32_t value = read(widget, msg);
+        int32_t k = key(widget, value);
+        bool zero = isZero(widget, msg);
+        if (k == state[i].key && zero == state[i].zero)
+            continue;
+
+        Box box = bounds(widget, state[i]);
+        clear(box);
+        state[i].width = draw(widget, value, zero);
+        redrawOverlapping(box);
+        state[i].key = k;
+        state[i].zero = zero;
+        changed = true;
+    }
+    return changed;
+}
+
+void CarWidgets::invalidate()
+{
+    drawn = false;
+}
+
+uint8_t CarWidgets::formatFixed(char* buf, int32_t value, uint8_t decimals)
+{
+    return u8x8_s32tofixp(buf, value, decimals, 0, ' ');
+}
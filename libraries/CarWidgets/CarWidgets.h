@@ -0,0 +1,131 @@
+#ifndef CARWIDGETS_H
+#define CARWIDGETS_H
+
+/*
+
+Retained widgets for the car OLED dashboards
+A layout is a static table of labels, numeric readouts, icons and bar gauges, each bound to a field of
+a message struct (CarInfoMsg etc.) by offsetof(). update() compares every bound field against what is on
+the screen and only clears and redraws the widgets that changed, so U8g2 only marks their tiles dirty
+
+Values are compared after formatting - a float shown with 1 decimal only redraws when the tenths change,
+a bar gauge only when its filled width changes
+
+*/
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+#include <stddef.h>
+
+#define WIDGET_TEXT_MAX (U8X8_FIXED_BUF_LEN + 4) // Longest formatted value incl. suffix
+
+enum WidgetType : uint8_t
+{
+    WIDGET_TYPE_LABEL,  // Static text
+    WIDGET_TYPE_NUMBER, // Right aligned fixed-point readout
+    WIDGET_TYPE_ICON,   // XBM bitmap, optionally only shown while a field is non-zero
+    WIDGET_TYPE_BAR,    // Horizontal gauge filled from min to max
+    WIDGET_TYPE_BITMAP, // Compiled bitmap (bmp2tiles.py --compiled), same as an icon without XBM bit scanning
+};
+
+enum WidgetValueType : uint8_t
+{
+    WIDGET_VALUE_NONE,
+    WIDGET_VALUE_BOOL,
+    WIDGET_VALUE_U8,
+    WIDGET_VALUE_U16,
+    WIDGET_VALUE_I16,
+    WIDGET_VALUE_U32,
+    WIDGET_VALUE_I32,
+    WIDGET_VALUE_FLOAT,
+};
+
+// Maps a field's type to its WidgetValueType, used by WIDGET_FIELD()
+template <typename T> struct WidgetValueTypeOf;
+template <> struct WidgetValueTypeOf<bool> { static const WidgetValueType value = WIDGET_VALUE_BOOL; };
+template <> struct WidgetValueTypeOf<uint8_t> { static const WidgetValueType value = WIDGET_VALUE_U8; };
+template <> struct WidgetValueTypeOf<uint16_t> { static const WidgetValueType value = WIDGET_VALUE_U16; };
+template <> struct WidgetValueTypeOf<int16_t> { static const WidgetValueType value = WIDGET_VALUE_I16; };
+template <> struct WidgetValueTypeOf<uint32_t> { static const WidgetValueType value = WIDGET_VALUE_U32; };
+template <> struct WidgetValueTypeOf<int32_t> { static const WidgetValueType value = WIDGET_VALUE_I32; };
+template <> struct WidgetValueTypeOf<float> { static const WidgetValueType value = WIDGET_VALUE_FLOAT; };
+
+struct Widget
+{
+    WidgetType type;
+    WidgetValueType valueType; // WIDGET_VALUE_NONE for static widgets
+    uint16_t offset;           // Of the bound field in the message
+    uint8_t decimals;          // Number: digits after the point, the field is scaled by 10^decimals
+    int16_t x, y;              // Number: right edge and baseline, label: left edge and baseline, icon/bar: top left
+    uint8_t w, h;              // Number: width cleared on change, icon/bar: size (bitmaps store their own)
+    const uint8_t* font;       // Label/number
+    const void* data;          // Label: text, icon: XBM bitmap, bitmap: compiled bitmap (both PROGMEM)
+    const char* suffix;        // Number: appended to the value ("c"), may be nullptr
+    const char* zeroText;      // Number: shown instead of 0 ("---"), may be nullptr
+    int32_t min, max;          // Bar: range of the field (scaled by 10^decimals for floats)
+};
+
+// Type and offset of a message field, e.g. WIDGET_FIELD(CarInfoMsg, kmRemaining)
+#define WIDGET_FIELD(msgType, field) WidgetValueTypeOf<decltype(msgType::field)>::value, (uint16_t)offsetof(msgType, field)
+
+#define WIDGET_LABEL(x, y, font, text) \
+    { WIDGET_TYPE_LABEL, WIDGET_VALUE_NONE, 0, 0, x, y, 0, 0, font, text, nullptr, nullptr, 0, 0 }
+#define WIDGET_NUMBER(msgType, field, right, baseline, width, font, decimals, suffix, zeroText) \
+    { WIDGET_TYPE_NUMBER, WIDGET_FIELD(msgType, field), decimals, right, baseline, width, 0, font, nullptr, suffix, zeroText, 0, 0 }
+#define WIDGET_ICON(x, y, w, h, xbm) \
+    { WIDGET_TYPE_ICON, WIDGET_VALUE_NONE, 0, 0, x, y, w, h, nullptr, xbm, nullptr, nullptr, 0, 0 }
+#define WIDGET_ICON_IF(msgType, field, x, y, w, h, xbm) \
+    { WIDGET_TYPE_ICON, WIDGET_FIELD(msgType, field), 0, x, y, w, h, nullptr, xbm, nullptr, nullptr, 0, 0 }
+#define WIDGET_BITMAP(x, y, cbmp) \
+    { WIDGET_TYPE_BITMAP, WIDGET_VALUE_NONE, 0, 0, x, y, 0, 0, nullptr, cbmp, nullptr, nullptr, 0, 0 }
+#define WIDGET_BITMAP_IF(msgType, field, x, y, cbmp) \
+    { WIDGET_TYPE_BITMAP, WIDGET_FIELD(msgType, field), 0, x, y, 0, 0, nullptr, cbmp, nullptr, nullptr, 0, 0 }
+#define WIDGET_BAR(msgType, field, x, y, w, h, min, max) \
+    { WIDGET_TYPE_BAR, WIDGET_FIELD(msgType, field), 0, x, y, w, h, nullptr, nullptr, nullptr, nullptr, min, max }
+
+#define WIDGET_COUNT(table) (sizeof(table) / sizeof(Widget))
+
+// What a widget shows right now, one per widget of the layout - declared next to the layout, no heap
+struct WidgetState
+{
+    int32_t key;   // Scaled value, or filled width for bars
+    bool zero;     // Number: the field was exactly 0 (zeroText shown)
+    u8g2_uint_t width; // Number: width of the drawn text
+};
+
+
+class CarWidgets
+{
+    private:
+        struct Box
+        {
+            int16_t x, y;
+            int16_t w, h;
+        };
+
+        U8G2& u8g2;
+        const Widget* widgets;
+        WidgetState* state;
+        uint8_t count;
+        bool drawn = false;
+
+        int32_t read(const Widget& widget, const void* msg);
+        bool isZero(const Widget& widget, const void* msg);
+        int32_t key(const Widget& widget, int32_t value);
+        Box bounds(const Widget& widget, const WidgetState& shown);
+        void clear(const Box& box);
+        u8g2_uint_t draw(const Widget& widget, int32_t value, bool zero = false); // Returns the width of a number
+        void redrawOverlapping(const Box& box);
+
+    public:
+        CarWidgets(U8G2& u8g2, const Widget* widgets, WidgetState* state, uint8_t count);
+        template <size_t N>
+        CarWidgets(U8G2& u8g2, const Widget (&widgets)[N], WidgetState (&state)[N]) : CarWidgets(u8g2, widgets, state, N) {}
+
+        bool update(const void* msg); // Redraws what changed, returns true if anything was drawn
+        void invalidate();            // Clears the buffer and redraws everything on the next update()
+
+        static uint8_t formatFixed(char* buf, int32_t value, uint8_t decimals); // 12.3 from (123, 1), decimals <= 9, returns the length
+};
+
+#endif // ifndef CARWIDGETS_H
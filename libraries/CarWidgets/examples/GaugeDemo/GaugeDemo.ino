@@ -0,0 +1,45 @@
+#include <U8g2lib.h>
+#include "CarWidgets.h"
+
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/U8X8_PIN_NONE);
+
+// Any struct works, CarInfoMsg from CarComms is bound the same way
+struct Readings
+{
+  uint16_t rpm;
+  float voltage;
+  bool warning;
+};
+
+const unsigned char bmp_warning[] PROGMEM = {
+  0x18, 0x18, 0x3c, 0x24, 0x66, 0x42, 0xdb, 0xff
+};
+
+const Widget layout[] = {
+  WIDGET_LABEL(0, 12, u8g2_font_7x13_tr, "RPM"),
+  WIDGET_NUMBER(Readings, rpm, 80, 12, 50, u8g2_font_7x13_tr, 0, nullptr, nullptr),
+  WIDGET_BAR(Readings, rpm, 0, 18, 128, 10, 0, 7000),
+
+  WIDGET_LABEL(0, 50, u8g2_font_7x13_tr, "Batt"),
+  WIDGET_NUMBER(Readings, voltage, 80, 50, 50, u8g2_font_7x13_tr, 2, "V", nullptr),  // 12.64V
+  WIDGET_ICON_IF(Readings, warning, 120, 42, 8, 8, bmp_warning),
+};
+
+WidgetState layoutState[WIDGET_COUNT(layout)];
+CarWidgets widgets(u8g2, layout, layoutState);
+Readings readings;
+
+void setup() {
+  u8g2.begin();
+}
+
+void loop() {
+  readings.rpm = (millis() / 10) % 7000;
+  readings.voltage = 12.0f + (millis() % 1000) / 1000.0f;
+  readings.warning = readings.rpm > 6000;
+
+  // Only the widgets whose shown value changed are redrawn, sendDirty() only sends their tiles
+  if (widgets.update(&readings))
+    u8g2.sendDirty();
+  delay(20);
+}
@@ -12,6 +12,26 @@ inline size_t LiquidCrystal_I2C::write(uint8_t value) {
 	return 1;
 }
 
+// Send a whole string with as few I2C transmissions as the Wire buffer allows
+size_t LiquidCrystal_I2C::write(const uint8_t *buffer, size_t size) {
+	size_t sent = 0;
+	while (sent < size) {
+		// The first char may need one more byte to switch RS to data
+		size_t batch = (LCD_I2C_BUFFER_LENGTH - (_rsval != Rs)) / LCD_EXPANDER_BYTES_PER_CHAR;
+		size_t count = size - sent;
+		if (count > batch) {
+			count = batch;
+		}
+		Wire.beginTransmission(_Addr);
+		for (size_t i = 0; i < count; i++) {
+			queueNibbles(buffer[sent + i], Rs);
+		}
+		Wire.endTransmission();
+		sent += count;
+	}
+	return sent;
+}
+
 #else
 #include "WProgram.h"
 
@@ -50,12 +70,21 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t l
   _cols = lcd_cols;
   _rows = lcd_rows;
   _backlightval = LCD_NOBACKLIGHT;
+  _rsval = 0;
 }
 
 void LiquidCrystal_I2C::init(){
 	init_priv();
 }
 
+// The PCF8574 is only rated for 100 kHz, but most backpacks run fine at 400 kHz
+void LiquidCrystal_I2C::setClock(uint32_t clockHz){
+	if (clockHz > LCD_I2C_MAX_CLOCK) {
+		clockHz = LCD_I2C_MAX_CLOCK;
+	}
+	Wire.setClock(clockHz);
+}
+
 void LiquidCrystal_I2C::init_priv()
 {
 	Wire.begin();
@@ -238,10 +267,28 @@ inline void LiquidCrystal_I2C::command(uint8_t value) {
 
 // write either command or data
 void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) {
-	uint8_t highnib=value&0xf0;
-	uint8_t lownib=(value<<4)&0xf0;
-       write4bits((highnib)|mode);
-	write4bits((lownib)|mode); 
+	Wire.beginTransmission(_Addr);
+	queueNibbles(value, mode);
+	Wire.endTransmission();
+}
+
+// Queue both nibbles with their enable pulses into the current transmission.
+// The expander latches each byte on its ACK, so one I2C byte time (>= 22.5us
+// at 400 kHz) is both the enable pulse width (>450ns) and, across the two
+// bytes before the next falling edge, the >37us the LCD needs to execute.
+// RS has to be stable before E rises (tAS >= 40ns), so when it changes it
+// gets a byte of its own first.
+void LiquidCrystal_I2C::queueNibbles(uint8_t value, uint8_t mode) {
+	uint8_t highnib=(value&0xf0)|mode|_backlightval;
+	uint8_t lownib=((value<<4)&0xf0)|mode|_backlightval;
+	if (mode != _rsval) {
+		printIIC((int)(highnib & ~En));
+		_rsval = mode;
+	}
+	printIIC((int)(highnib | En));
+	printIIC((int)(highnib & ~En));
+	printIIC((int)(lownib | En));
+	printIIC((int)(lownib & ~En));
 }
 
 void LiquidCrystal_I2C::write4bits(uint8_t value) {
@@ -253,6 +300,7 @@ void LiquidCrystal_I2C::expanderWrite(uint8_t _data){
 	Wire.beginTransmission(_Addr);
 	printIIC((int)(_data) | _backlightval);
 	Wire.endTransmission();   
+	_rsval = _data & Rs;
 }
 
 void LiquidCrystal_I2C::pulseEnable(uint8_t _data){
@@ -52,6 +52,23 @@
 #define Rw B00000010  // Read/Write bit
 #define Rs B00000001  // Register select bit
 
+// Bytes the Wire library can queue in a single transmission
+#if defined(I2C_BUFFER_LENGTH)
+#define LCD_I2C_BUFFER_LENGTH I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define LCD_I2C_BUFFER_LENGTH BUFFER_LENGTH
+#else
+#define LCD_I2C_BUFFER_LENGTH 32
+#endif
+
+// Every byte sent to the LCD is 4 expander writes (high/low nibble, each with En high then low),
+// plus one more when it switches RS between command and data
+#define LCD_EXPANDER_BYTES_PER_CHAR 4
+
+// The batched path uses the I2C byte time as the enable pulse/settle delay,
+// which only holds up to fast-mode (400 kHz)
+#define LCD_I2C_MAX_CLOCK 400000
+
 class LiquidCrystal_I2C : public Print {
 public:
   LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t lcd_rows);
@@ -80,11 +97,13 @@ public:
   void setCursor(uint8_t, uint8_t); 
 #if defined(ARDUINO) && ARDUINO >= 100
   virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buffer, size_t size);	// batched, used by print()
 #else
   virtual void write(uint8_t);
 #endif
   void command(uint8_t);
   void init();
+  void setClock(uint32_t clockHz = LCD_I2C_MAX_CLOCK);	// raise the bus to fast-mode
 
 ////compatibility API function aliases
 void blink_on();						// alias for blink()
@@ -110,6 +129,7 @@ void draw_vertical_graph(uint8_t row, uint8_t column, uint8_t len,  uint8_t pixe
 private:
   void init_priv();
   void send(uint8_t, uint8_t);
+  void queueNibbles(uint8_t, uint8_t);
   void write4bits(uint8_t);
   void expanderWrite(uint8_t);
   void pulseEnable(uint8_t);
@@ -121,6 +141,7 @@ private:
   uint8_t _cols;
   uint8_t _rows;
   uint8_t _backlightval;
+  uint8_t _rsval;  // RS level the expander is driving now
 };
 
 #endif
@@ -0,0 +1,16 @@
+// Minimal host stand-in for the Arduino core, just enough to build LiquidCrystal_I2C
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+
+inline void delay(unsigned long) {}
+inline void delayMicroseconds(unsigned int) {}
+
+#endif
@@ -0,0 +1,68 @@
+/*
+  Host benchmark for the batched LiquidCrystal_I2C write path.
+  Counts I2C transactions against a mock Wire instead of real hardware.
+
+  Build and run from this folder:
+    g++ -DARDUINO=10819 -I. -I../.. HostBench.cpp ../../LiquidCrystal_I2C.cpp -o HostBench && ./HostBench
+*/
+
+#include <stdio.h>
+#include "LiquidCrystal_I2C.h"
+
+TwoWire Wire;
+LiquidCrystal_I2C lcd(0x27, 20, 4);
+
+static const char line[] = "Daveikis Mobile 1234";  // 20 chars, a full row
+
+// The old unbatched send(): each nibble was its own expanderWrite() plus an
+// En high/low pulse, one transmission per expander byte
+static void legacyExpanderWrite(uint8_t data)
+{
+  Wire.beginTransmission(0x27);
+  Wire.write(data | LCD_BACKLIGHT);
+  Wire.endTransmission();
+}
+
+static void legacySend(uint8_t value, uint8_t mode)
+{
+  uint8_t nibbles[2] = { (uint8_t)((value & 0xf0) | mode), (uint8_t)(((value << 4) & 0xf0) | mode) };
+  for (int i = 0; i < 2; i++) {
+    legacyExpanderWrite(nibbles[i]);
+    legacyExpanderWrite(nibbles[i] | En);
+    legacyExpanderWrite(nibbles[i] & ~En);
+  }
+}
+
+static void report(const char *name)
+{
+  printf("%-24s %4u transactions %5u bytes %6u us bus time @ %u kHz%s\n", name,
+         (unsigned)Wire.transactions, (unsigned)Wire.bytes, (unsigned)Wire.busTimeUS(),
+         (unsigned)(Wire.clockHz / 1000), Wire.dropped ? "  (BYTES DROPPED)" : "");
+  Wire.reset();
+}
+
+int main()
+{
+  lcd.init();
+  Wire.reset();
+
+  for (int pass = 0; pass < 2; pass++) {
+    // Unbatched reference: what the old send() cost
+    for (size_t i = 0; i < sizeof(line) - 1; i++) legacySend((uint8_t)line[i], Rs);
+    report("legacy print (per char)");
+
+    for (size_t i = 0; i < sizeof(line) - 1; i++) lcd.write((uint8_t)line[i]);
+    report("write() per char");
+
+    lcd.print(line);
+    report("print() batched");
+
+    lcd.setCursor(0, 1);
+    lcd.print(line);
+    report("setCursor + print()");
+
+    lcd.setClock();
+    printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,20 @@
+// Minimal host stand-in for Print.h
+#ifndef Print_h
+#define Print_h
+
+#include "Arduino.h"
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) { return write((const uint8_t *)str, strlen(str)); }
+  size_t print(const char *str) { return write(str); }
+};
+
+#endif
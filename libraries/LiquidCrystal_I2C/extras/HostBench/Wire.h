@@ -0,0 +1,42 @@
+// Host mock of the Wire library that counts transactions instead of talking to a bus
+#ifndef TwoWire_h
+#define TwoWire_h
+
+#include "Arduino.h"
+
+#ifndef BUFFER_LENGTH
+#define BUFFER_LENGTH 128  // ESP8266 core value; build with -DBUFFER_LENGTH=32 for AVR
+#endif
+
+class TwoWire {
+public:
+  uint32_t clockHz = 100000;
+  uint32_t transactions = 0;
+  uint32_t bytes = 0;
+  uint32_t dropped = 0;  // Bytes past BUFFER_LENGTH, which the real library would lose
+  uint8_t queued = 0;
+
+  void begin() {}
+  void setClock(uint32_t hz) { clockHz = hz; }
+  void beginTransmission(uint8_t) { queued = 0; }
+  size_t write(uint8_t) {
+    if (queued >= BUFFER_LENGTH) {
+      dropped++;
+      return 0;
+    }
+    queued++;
+    return 1;
+  }
+  uint8_t endTransmission() {
+    transactions++;
+    bytes += queued + 1;  // Address byte
+    return 0;
+  }
+  void reset() { transactions = bytes = dropped = 0; }
+  // START + 9 clocks per byte (8 bits + ACK) + STOP, roughly
+  uint32_t busTimeUS() { return (uint32_t)((bytes * 9ULL + transactions * 2ULL) * 1000000ULL / clockHz); }
+};
+
+extern TwoWire Wire;
+
+#endif
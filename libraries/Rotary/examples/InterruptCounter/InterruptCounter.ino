@@ -0,0 +1,42 @@
+/////////////////////////////////////////////////////////////////
+
+#include "Rotary.h";
+
+/////////////////////////////////////////////////////////////////
+
+#define ROTARY_PIN1	14
+#define ROTARY_PIN2	12
+
+#define CLICKS_PER_STEP 4   // this number depends on your rotary encoder
+
+/////////////////////////////////////////////////////////////////
+
+Rotary r = Rotary(ROTARY_PIN1, ROTARY_PIN2, CLICKS_PER_STEP);
+
+/////////////////////////////////////////////////////////////////
+
+void setup() {
+  Serial.begin(9600);
+  delay(50);
+  Serial.println("\n\nInterrupt Counter");
+
+  r.setChangedHandler(rotate);
+  if (!r.attachInterrupts()) {
+    Serial.println("Pins don't support interrupts, polling instead");
+  }
+}
+
+void loop() {
+  r.loop();
+  // the interrupts keep counting while we're stuck here
+  delay(500);
+}
+
+/////////////////////////////////////////////////////////////////
+
+// called for every detent turned during the delay
+void rotate(Rotary& r) {
+   Serial.println(r.getPosition());
+}
+
+/////////////////////////////////////////////////////////////////
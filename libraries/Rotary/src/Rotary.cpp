@@ -7,6 +7,39 @@
 
 #include "Rotary.h"
 
+#if defined(ESP32)
+#include "hal/gpio_ll.h"
+#endif
+
+/////////////////////////////////////////////////////////////////
+
+// change in position for each (previous A/B, current A/B) pair
+static const int8_t ROTARY_DRAM_ATTR ROTARY_STEPS[16] = {
+   0,  1, -1,  2,
+  -1,  0, -2,  1,
+   1, -2,  0, -1,
+   2, -1,  1,  0
+};
+
+/////////////////////////////////////////////////////////////////
+
+Rotary* Rotary::isr_instances[ROTARY_MAX_INTERRUPT_ENCODERS] = { NULL };
+
+const Rotary::IsrFunction Rotary::isr_functions[ROTARY_MAX_INTERRUPT_ENCODERS] = {
+  Rotary::isr<0>, Rotary::isr<1>, Rotary::isr<2>, Rotary::isr<3>
+};
+
+/////////////////////////////////////////////////////////////////
+
+// digitalRead() isn't safe to call from IRAM on the ESP32
+static inline __attribute__((always_inline)) bool readPin(byte pin) {
+#if defined(ESP32)
+  return gpio_ll_get_level(&GPIO, (gpio_num_t)pin);
+#else
+  return digitalRead(pin);
+#endif
+}
+
 /////////////////////////////////////////////////////////////////
 
 Rotary::Rotary() {
@@ -92,6 +125,11 @@ void Rotary::setLowerOverflowHandler(CallbackFunction f) {
 /////////////////////////////////////////////////////////////////
 
 void Rotary::resetPosition(int p /* = 0 */, bool fireCallback /* = true */) {
+  if (isr_slot >= 0) {
+    consumed_steps = readInterruptSteps();
+  }
+  pending_steps = 0;
+
   if (p > upper_bound) {
     last_position = upper_bound * steps_per_click;
   } else {
@@ -107,8 +145,9 @@ void Rotary::resetPosition(int p /* = 0 */, bool fireCallback /* = true */) {
 
 /////////////////////////////////////////////////////////////////
 
+// negative reverses the direction, 0 would never move
 void Rotary::setIncrement(int inc) {
-  increment = inc;
+  increment = (inc == 0) ? 1 : inc;
 }
 
 /////////////////////////////////////////////////////////////////
@@ -131,6 +170,49 @@ int Rotary::getStepsPerClick() {
 
 /////////////////////////////////////////////////////////////////
 
+void Rotary::setAcceleration(byte max_multiplier /* = ROTARY_ACCEL_MAX_MULTIPLIER */, unsigned int slow_ms /* = ROTARY_ACCEL_SLOW_MS */, unsigned int fast_ms /* = ROTARY_ACCEL_FAST_MS */) {
+  accel_max_multiplier = (max_multiplier < 1) ? 1 : max_multiplier;
+  accel_slow_ms = slow_ms;
+  accel_fast_ms = (fast_ms < slow_ms) ? fast_ms : slow_ms;
+}
+
+/////////////////////////////////////////////////////////////////
+
+// detents reported to the current callback, negative when turning left
+int Rotary::getDetents() {
+  return last_detents;
+}
+
+/////////////////////////////////////////////////////////////////
+
+// getDetents() scaled up by how quickly they were turned
+int Rotary::getAcceleratedDelta() {
+  return last_delta;
+}
+
+/////////////////////////////////////////////////////////////////
+
+// average time between the detents reported to the current callback
+unsigned long Rotary::getDetentInterval() {
+  return last_interval_ms;
+}
+
+/////////////////////////////////////////////////////////////////
+
+int Rotary::accelerationMultiplier(unsigned long interval_ms) {
+  if (accel_max_multiplier <= 1 || interval_ms >= accel_slow_ms) return 1;
+  if (interval_ms <= accel_fast_ms) return accel_max_multiplier;
+  return 1 + (long)(accel_max_multiplier - 1) * (accel_slow_ms - interval_ms) / (accel_slow_ms - accel_fast_ms);
+}
+
+/////////////////////////////////////////////////////////////////
+
+bool Rotary::inBounds(int pos) {
+  return pos >= lower_bound && pos <= upper_bound;
+}
+
+/////////////////////////////////////////////////////////////////
+
 byte Rotary::getDirection() {
   return direction;
 }
@@ -153,28 +235,130 @@ int Rotary::getPosition() {
 
 /////////////////////////////////////////////////////////////////
 
+bool Rotary::attachInterrupts() {
+  if (isr_slot >= 0) return true;
+#ifdef NOT_AN_INTERRUPT
+  if (digitalPinToInterrupt(pin1) == NOT_AN_INTERRUPT || digitalPinToInterrupt(pin2) == NOT_AN_INTERRUPT) return false;
+#endif
+
+  for (byte i = 0; i < ROTARY_MAX_INTERRUPT_ENCODERS; i++) {
+    if (isr_instances[i] != NULL) continue;
+
+    isr_state = (readPin(pin1) ? 1 : 0) | (readPin(pin2) ? 2 : 0);
+    consumed_steps = isr_steps;
+    pending_steps = 0;
+    isr_slot = i;
+    isr_instances[i] = this;
+    attachInterrupt(digitalPinToInterrupt(pin1), isr_functions[i], CHANGE);
+    attachInterrupt(digitalPinToInterrupt(pin2), isr_functions[i], CHANGE);
+    return true;
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////////////////////
+
+void Rotary::detachInterrupts() {
+  if (isr_slot < 0) return;
+
+  detachInterrupt(digitalPinToInterrupt(pin1));
+  detachInterrupt(digitalPinToInterrupt(pin2));
+  isr_instances[isr_slot] = NULL;
+  isr_slot = -1;
+  state = isr_state;
+}
+
+/////////////////////////////////////////////////////////////////
+
+bool Rotary::isInterruptDriven() {
+  return isr_slot >= 0;
+}
+
+/////////////////////////////////////////////////////////////////
+
+template <byte slot>
+void ROTARY_ISR_ATTR Rotary::isr() {
+  Rotary* r = isr_instances[slot];
+  if (r != NULL) r->handleInterrupt();
+}
+
+/////////////////////////////////////////////////////////////////
+
+void ROTARY_ISR_ATTR Rotary::handleInterrupt() {
+  byte s = isr_state & 3;
+  if (readPin(pin1)) s |= 4;
+  if (readPin(pin2)) s |= 8;
+  isr_steps += ROTARY_STEPS[s];
+  isr_state = (s >> 2);
+}
+
+/////////////////////////////////////////////////////////////////
+
+int32_t Rotary::readInterruptSteps() {
+#if defined(__AVR__)
+  // 32 bit loads take several instructions here
+  noInterrupts();
+  int32_t steps = isr_steps;
+  interrupts();
+  return steps;
+#else
+  // single writer, aligned 32 bit load - no lock needed
+  return isr_steps;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////
+
 void Rotary::loop() {
-  int s = state & 3;
-  if (digitalRead(pin1)) s |= 4;
-  if (digitalRead(pin2)) s |= 8;
-
-  switch (s) {
-    case 0: case 5: case 10: case 15:
-      break;
-    case 1: case 7: case 8: case 14:
-        position += increment; break;
-    case 2: case 4: case 11: case 13:
-      position -= increment; break;
-    case 3: case 12:
-      position += 2 * increment; break;
-    default:
-      position -= 2 * increment; break;
+  if (isr_slot < 0) {
+    int s = state & 3;
+    if (digitalRead(pin1)) s |= 4;
+    if (digitalRead(pin2)) s |= 8;
+
+    position += ROTARY_STEPS[s] * increment;
+    state = (s >> 2);
+
+    checkPosition();
+    return;
   }
-  state = (s >> 2);
 
-  if (position != last_position && (abs(position - last_position) >= steps_per_click * increment)) {
+  // interrupt mode: everything decoded since the last call, however long ago that was
+  int32_t steps = readInterruptSteps();
+  pending_steps += (int32_t)((uint32_t)steps - (uint32_t)consumed_steps) * increment;
+  consumed_steps = steps;
+
+  // hand it over one detent at a time so each one fires its callbacks,
+  // or all at once when accelerating so a fast spin is a single callback
+  // pending_steps already carries the sign of increment
+  int detent = abs(steps_per_click * increment);
+  while (abs(pending_steps) >= detent) {
+    int sign = (pending_steps > 0) ? 1 : -1;
+    int detents = sign;
+    if (accel_max_multiplier > 1) {
+      detents = pending_steps / detent;
+      // stop at the bound rather than throwing the whole spin away
+      while (detents != sign && !inBounds((position + detents * detent) / steps_per_click)) detents -= sign;
+    }
+    int move = detents * detent;
+    pending_steps -= move;
+    position += move;
+    checkPosition();
+  }
+}
+
+/////////////////////////////////////////////////////////////////
+
+void Rotary::checkPosition() {
+  int detent = abs(steps_per_click * increment);
+  if (position != last_position && (abs(position - last_position) >= detent)) {
     int current_position = getPosition();
-    if (current_position >= lower_bound && current_position <= upper_bound) {
+    if (inBounds(current_position)) {
+      unsigned long now = millis();
+      last_detents = (position - last_position) / detent;
+      last_interval_ms = (now - last_detent_ms) / abs(last_detents);
+      last_delta = last_detents * accelerationMultiplier(last_interval_ms);
+      last_detent_ms = now;
+
       if (position > last_position) {
         direction = RE_RIGHT;
         if (right_cb != NULL) right_cb (*this);
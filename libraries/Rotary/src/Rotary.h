@@ -18,6 +18,28 @@
 #define RE_RIGHT            1
 #define RE_LEFT             255
 
+// acceleration defaults: detents further apart than SLOW_MS count once,
+// closer together than FAST_MS count MAX_MULTIPLIER times, linear in between
+#define ROTARY_ACCEL_SLOW_MS        100
+#define ROTARY_ACCEL_FAST_MS        15
+#define ROTARY_ACCEL_MAX_MULTIPLIER 8
+
+// one interrupt trampoline per slot in Rotary.cpp
+#define ROTARY_MAX_INTERRUPT_ENCODERS 4
+
+// the ISR can run while the flash cache is off (e.g. during an NVS write),
+// so it and everything it touches has to live in RAM
+#if defined(ESP32)
+  #define ROTARY_ISR_ATTR   IRAM_ATTR
+  #define ROTARY_DRAM_ATTR  DRAM_ATTR
+#elif defined(ESP8266)
+  #define ROTARY_ISR_ATTR   IRAM_ATTR
+  #define ROTARY_DRAM_ATTR  // const data is already in RAM
+#else
+  #define ROTARY_ISR_ATTR
+  #define ROTARY_DRAM_ATTR
+#endif
+
 /////////////////////////////////////////////////////////////////
 
 class Rotary {
@@ -30,6 +52,33 @@ class Rotary {
    byte state;
    int increment;
 
+   // interrupt mode: the ISR only ever writes isr_steps, loop() only reads it
+   volatile int32_t isr_steps = 0;
+   volatile byte isr_state = 0;
+   int32_t consumed_steps = 0;
+   int pending_steps = 0;
+   int8_t isr_slot = -1;
+
+   // acceleration, max_multiplier of 1 turns it off
+   byte accel_max_multiplier = 1;
+   unsigned int accel_slow_ms = ROTARY_ACCEL_SLOW_MS;
+   unsigned int accel_fast_ms = ROTARY_ACCEL_FAST_MS;
+   unsigned long last_detent_ms = 0;
+   unsigned long last_interval_ms = 0;
+   int last_detents = 0;
+   int last_delta = 0;
+
+   static Rotary* isr_instances[ROTARY_MAX_INTERRUPT_ENCODERS];
+   typedef void (*IsrFunction) ();
+   static const IsrFunction isr_functions[ROTARY_MAX_INTERRUPT_ENCODERS];
+   template <byte slot> static void isr();
+
+   void handleInterrupt();
+   int32_t readInterruptSteps();
+   void checkPosition();
+   bool inBounds(int pos);
+   int accelerationMultiplier(unsigned long interval_ms);
+
     typedef void (*CallbackFunction) (Rotary&);
     CallbackFunction change_cb = NULL;
     CallbackFunction right_cb = NULL;
@@ -58,6 +107,11 @@ class Rotary {
    void setStepsPerClick(int steps);
    int getStepsPerClick();
 
+   void setAcceleration(byte max_multiplier = ROTARY_ACCEL_MAX_MULTIPLIER, unsigned int slow_ms = ROTARY_ACCEL_SLOW_MS, unsigned int fast_ms = ROTARY_ACCEL_FAST_MS);
+   int getDetents();
+   int getAcceleratedDelta();
+   unsigned long getDetentInterval();
+
    String directionToString(byte direction);
    
    void setChangedHandler(CallbackFunction f);
@@ -66,6 +120,10 @@ class Rotary {
    void setUpperOverflowHandler(CallbackFunction f);
    void setLowerOverflowHandler(CallbackFunction f);
 
+   bool attachInterrupts();
+   void detachInterrupts();
+   bool isInterruptDriven();
+
    void loop();
 };
 
@@ -0,0 +1,149 @@
+/*
+
+  FPS_Transfer.ino
+  
+  Frames Per Second: Display Transfer Test
+  
+  Variant of the FPS example which only measures the transfer to the display.
+  The same picture is sent with different transfer methods:
+  
+    tile rows	updateDisplayArea() for the complete display: one transfer with
+		column/page commands for each tile row (the method which was used 
+		by sendBuffer() before U8X8_MSG_DISPLAY_DRAW_FRAME)
+    frame	sendBuffer(): SSD1306 displays send the complete buffer as one 
+		data stream in horizontal addressing mode
+    dirty	sendDirty() after changing a small area: only the modified 
+		tiles are sent
+  
+  The I2C data chunk size (U8X8_I2C_DATA_CHUNK) is printed as well, it is 24 
+  for AVR and 127 for ESP8266/ESP32.
+  Results are written to the serial monitor (115200 baud) and to the display.
+
+  >>> Before compiling: Please remove comment from the constructor of the 
+  >>> connected graphics display (see below).
+
+*/
+
+#include <Arduino.h>
+#include <U8g2lib.h>
+
+#ifdef U8X8_HAVE_HW_SPI
+#include <SPI.h>
+#endif
+#ifdef U8X8_HAVE_HW_I2C
+#include <Wire.h>
+#endif
+
+// Please UNCOMMENT one of the contructor lines below
+// U8g2 Contructor List (Frame Buffer)
+// The complete list is available here: https://github.com/olikraus/u8g2/wiki/u8g2setupcpp
+// Please update the pin numbers according to your setup. Use U8X8_PIN_NONE if the reset pin is not connected
+U8G2_SSD1306_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_SSD1306_128X64_NONAME_F_SW_I2C u8g2(U8G2_R0, /* clock=*/ SCL, /* data=*/ SDA, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_SSD1306_128X64_NONAME_F_4W_HW_SPI u8g2(U8G2_R0, /* cs=*/ 10, /* dc=*/ 9, /* reset=*/ 8);
+//U8G2_SSD1306_128X64_VCOMH0_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_SSD1306_128X64_ALT0_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);
+//U8G2_SH1106_128X64_NONAME_F_HW_I2C u8g2(U8G2_R0, /* reset=*/ U8X8_PIN_NONE);	// no frame transfer, same result as "tile rows"
+
+// End of constructor list
+
+
+#define SECONDS 5
+uint8_t flip_color = 0;
+
+void draw_pixel(void) {
+  u8g2_uint_t x, y;
+  u8g2.setColorIndex(1);
+  for( y = 0; y < u8g2.getHeight(); y++ ) {
+    for( x = (y+flip_color) & 1; x < u8g2.getWidth(); x += 2 ) {
+      u8g2.drawPixel(x,y);
+    }
+  }
+}
+
+// picture loop with a full screen change for each frame, returns FPS*10
+uint16_t execute_with_fps(uint8_t is_frame) {
+  uint16_t frames = 0;
+  uint32_t time;
+  
+  time = millis() + SECONDS*1000;
+  do {
+    u8g2.clearBuffer();
+    draw_pixel();
+    if ( is_frame )
+      u8g2.sendBuffer();
+    else
+      u8g2.updateDisplayArea(0, 0, u8g2.getBufferTileWidth(), u8g2.getBufferTileHeight());
+    frames++;
+    flip_color = flip_color ^ 1;
+  } while( millis() < time );
+  return (uint32_t)frames*10/SECONDS;  
+}
+
+// only a small counter changes, returns FPS*10
+uint16_t execute_dirty_with_fps(void) {
+  uint16_t frames = 0;
+  uint32_t time;
+  
+  u8g2.clearBuffer();
+  draw_pixel();
+  u8g2.sendBuffer();
+  
+  time = millis() + SECONDS*1000;
+  do {
+    u8g2.setColorIndex(0);
+    u8g2.drawBox(0, 0, 24, 8);
+    u8g2.setColorIndex(1);
+    u8g2.drawBox(0, 0, frames % 24, 8);
+    u8g2.sendDirty();
+    frames++;
+  } while( millis() < time );
+  return (uint32_t)frames*10/SECONDS;  
+}
+
+const char *convert_FPS(uint16_t fps) {
+  static char buf[6];
+  strcpy(buf, u8g2_u8toa( (uint8_t)(fps/10), 3));
+  buf[3] =  '.';
+  buf[4] = (fps % 10) + '0';
+  buf[5] = '\0';
+  return buf;
+}
+
+void show_result(const char *s, uint16_t fps) {
+  Serial.print(s);
+  Serial.print(": ");
+  Serial.print(fps/10);
+  Serial.print(".");
+  Serial.print(fps%10);
+  Serial.println(" FPS");
+  
+  u8g2.setColorIndex(1);
+  u8g2.setFont(u8g2_font_8x13B_tf);
+  u8g2.clearBuffer();
+  u8g2.drawStr(0,12, s);
+  u8g2.drawStr(0,24, convert_FPS(fps));
+  u8g2.sendBuffer();
+}
+
+void setup(void) {
+  Serial.begin(115200);
+  u8g2.begin();
+  //u8g2.setBusClock(400000);
+  
+  Serial.print("I2C data chunk: ");
+  Serial.println(U8X8_I2C_DATA_CHUNK);
+}
+
+void loop(void) {
+  uint16_t fps;
+  fps = execute_with_fps(0);
+  show_result("tile rows", fps);
+  delay(3000);
+  fps = execute_with_fps(1);
+  show_result("frame", fps);
+  delay(3000);
+  fps = execute_dirty_with_fps();
+  show_result("dirty", fps);
+  delay(3000);
+}
@@ -0,0 +1,393 @@
+/*
+
+  bench.c
+  
+  Host benchmark and golden image test for the u8g2 C library.
+  
+  Renders the screens of the sketches in this repository into a SSD1306 
+  128x64 full buffer, sends them through the emulated I2C bus (u8g2_host.c) 
+  and reports:
+    - ns per call for the drawing primitives
+    - glyph lookups and decodes per frame (text screens)
+    - bytes and transactions on the bus, estimated bus time at 400 kHz
+  
+  Usage (see Makefile):
+    ./bench			run the benchmark
+    ./bench --dump <dir>	write the screens as PBM files
+    ./bench --check <dir>	compare the screens against the PBM files in <dir>
+  
+  The text screens need the fonts (clib/u8g2_fonts.c). Without it, the
+  Makefile defines U8G2_HOST_NO_FONTS and only the graphics screens are used.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "u8g2_host.h"
+#ifndef U8G2_HOST_NO_FONTS
+#include "mui.h"
+#include "mui_u8g2.h"
+#endif
+
+#define PROGMEM
+#include "AudioSwitcherDisplay/Screens.h"
+
+static u8g2_t u8g2;
+static uint8_t shadow[1024];
+
+/*===============================================*/
+/* screens */
+
+/* XBM version of cbmp_coolant, CarInfoDisplay.ino */
+static const unsigned char bmp_coolant[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0xf8, 0x03, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x18,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0xf8, 0x03, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3c, 0x00,
+    0x0c, 0x3c, 0x30, 0x92, 0x3c, 0x49, 0x61, 0x18, 0x86, 0x00, 0x00, 0x00, 0x0c, 0xc3, 0x30, 0xf2,
+    0x3c, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/* copy of cbmp_coolant, CarInfoDisplay.ino (bmp2tiles.py --compiled) */
+static const unsigned char cbmp_coolant[] = {
+    0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x92, 0x12, 0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x22, 0x11, 0x11, 0x22, 0x24, 0x24, 0x22, 0x10, 0x10, 0x23, 0x27, 0x27, 0x23,
+    0x10, 0x10, 0x22, 0x24, 0x24, 0x22, 0x11, 0x11, 0x22, 0x04,
+};
+
+typedef struct
+{
+  const char *name;
+  const unsigned char *tiles;
+} audio_screen_t;
+
+/* same order as displays[] in AudioSwitcherDisplay.ino */
+static const audio_screen_t audio_screens[] = {
+  { "audio_bluetooth", tiles_D_Bluetooth },
+  { "audio_aux", tiles_D_Aux },
+  { "audio_lightning", tiles_D_Lightning },
+  { "audio_usb", tiles_D_USB },
+  { "audio_carputer", tiles_D_Carputer },
+};
+
+static void draw_audio_screen(uint8_t i)
+{
+  u8g2_DrawTileImage(&u8g2, 0, 0, 16, 8, audio_screens[i].tiles);
+}
+
+/* one frame of the slide between two screens in AudioSwitcherDisplay.ino */
+static void draw_audio_slide(uint8_t i, u8g2_uint_t offset)
+{
+  const unsigned char *from = audio_screens[i].tiles;
+  const unsigned char *to = audio_screens[(i+1) % 5].tiles;
+  u8g2_DrawTileImagePart(&u8g2, 0, 0, 128-offset, 8, from, 16, offset);
+  u8g2_DrawTileImagePart(&u8g2, 128-offset, 0, offset, 8, to, 16, 0);
+}
+
+static void draw_shapes(void)
+{
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_DrawFrame(&u8g2, 0, 0, 128, 64);
+  u8g2_DrawBox(&u8g2, 4, 4, 30, 20);
+  u8g2_DrawRFrame(&u8g2, 40, 4, 30, 20, 5);
+  u8g2_DrawCircle(&u8g2, 90, 14, 10, U8G2_DRAW_ALL);
+  u8g2_DrawDisc(&u8g2, 114, 14, 8, U8G2_DRAW_ALL);
+  u8g2_DrawLine(&u8g2, 4, 60, 60, 30);
+  u8g2_DrawTriangle(&u8g2, 70, 60, 90, 30, 110, 60);
+  u8g2_DrawXBM(&u8g2, 100, 36, 24, 24, bmp_coolant);
+}
+
+#ifndef U8G2_HOST_NO_FONTS
+/*
+  legacy reference: the old displayInfo() of CarInfoDisplay.ino, which cleared
+  and redrew the complete screen with sprintf/DrawStr for every message.
+  The sketch now draws the same layout through CarWidgets (C++, not part of
+  this C bench), which only redraws the fields whose value changed.
+*/
+static void draw_str_right(u8g2_uint_t right, u8g2_uint_t y, const char *s)
+{
+  u8g2_DrawStr(&u8g2, right - u8g2_GetStrWidth(&u8g2, s), y, s);
+}
+
+static void draw_car_info_legacy(int km, float avg, float inst, int coolant)
+{
+  char buf[16];
+  u8g2_ClearBuffer(&u8g2);
+  u8g2_SetFontRefHeightAll(&u8g2);
+  
+  u8g2_SetFont(&u8g2, u8g2_font_5x7_tr);
+  u8g2_DrawStr(&u8g2, 20, 6, "Range");
+  u8g2_SetFont(&u8g2, u8g2_font_7x13_tr);
+  u8g2_DrawStr(&u8g2, 52, 30, "km");
+  u8g2_SetFont(&u8g2, u8g2_font_5x7_tr);
+  u8g2_DrawStr(&u8g2, 1, 46, " Avg");
+  u8g2_DrawStr(&u8g2, 1, 61, "Inst");
+  u8g2_SetFont(&u8g2, u8g2_font_tiny5_tr);
+  u8g2_DrawStr(&u8g2, 56, 48, "L/100km");
+  u8g2_DrawStr(&u8g2, 56, 63, "L/100km");
+  u8g2_DrawXBM(&u8g2, 104, 0, 24, 24, bmp_coolant);
+  
+  u8g2_SetFont(&u8g2, u8g2_font_spleen16x32_mn);
+  snprintf(buf, sizeof(buf), "%d", km);
+  draw_str_right(48, 30, buf);
+  u8g2_SetFont(&u8g2, u8g2_font_7x13_tr);
+  snprintf(buf, sizeof(buf), "%.1f", avg);
+  draw_str_right(52, 48, buf);
+  snprintf(buf, sizeof(buf), "%.1f", inst);
+  draw_str_right(52, 63, buf);
+  snprintf(buf, sizeof(buf), "%dc", coolant);
+  draw_str_right(128, 35, buf);
+}
+
+/* small settings menu, the MUI example layout with the fonts of CarInfoDisplay */
+static uint8_t mui_brightness = 7;
+static uint8_t mui_units = 0;
+
+static muif_t muif_list[] = {
+  MUIF_U8G2_FONT_STYLE(0, u8g2_font_5x7_tr),
+  MUIF_U8G2_FONT_STYLE(1, u8g2_font_7x13_tr),
+  MUIF_U8G2_LABEL(),
+  MUIF_U8G2_U8_MIN_MAX("BR", &mui_brightness, 0, 15, mui_u8g2_u8_min_max_wm_mse_pi),
+  MUIF_VARIABLE("UN", &mui_units, mui_u8g2_u8_opt_line_wa_mse_pi),
+  MUIF_BUTTON("GO", mui_u8g2_btn_exit_wm_fi)
+};
+
+static fds_t fds_data[] = 
+  MUI_FORM(1)
+  MUI_STYLE(1)
+  MUI_LABEL(5, 12, "Settings")
+  MUI_STYLE(0)
+  MUI_LABEL(5, 30, "Brightness:")
+  MUI_XY("BR", 70, 30)
+  MUI_LABEL(5, 44, "Units:")
+  MUI_XYAT("UN", 70, 44, 50, "km|mi")
+  MUI_XYT("GO", 64, 59, " OK ")
+  ;
+
+static mui_t mui;
+
+static void draw_mui(void)
+{
+  u8g2_ClearBuffer(&u8g2);
+  mui_Draw(&mui);
+}
+#endif /* U8G2_HOST_NO_FONTS */
+
+/*===============================================*/
+/* benchmark */
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+static uint32_t loop_i;
+
+#define BENCH(name, n, code) \
+  do { \
+    uint64_t t = now_ns(); \
+    for( loop_i = 0; loop_i < (n); loop_i++ ) { code; } \
+    printf("  %-34s %10.1f ns\n", name, (double)(now_ns() - t)/(n)); \
+  } while(0)
+
+static void report_bus(const char *name, uint32_t frames)
+{
+  printf("  %-34s %6lu bytes %4lu transactions %6lu us @ 400 kHz\n", name,
+    (unsigned long)(u8g2_host_bus.bytes/frames), (unsigned long)(u8g2_host_bus.transactions/frames), 
+    (unsigned long)(u8g2_host_GetBusTimeUS(400000)/frames));
+  u8g2_host_ResetBus();
+}
+
+static void bench_primitives(void)
+{
+  printf("Primitives\n");
+  BENCH("clearBuffer", 100000, u8g2_ClearBuffer(&u8g2));
+  BENCH("drawPixel", 1000000, u8g2_DrawPixel(&u8g2, loop_i & 127, (loop_i >> 7) & 63));
+  BENCH("drawHLine w=64", 1000000, u8g2_DrawHLine(&u8g2, loop_i & 63, loop_i & 63, 64));
+  BENCH("drawVLine h=32", 1000000, u8g2_DrawVLine(&u8g2, loop_i & 127, loop_i & 31, 32));
+  BENCH("drawBox 32x16", 200000, u8g2_DrawBox(&u8g2, loop_i & 63, loop_i & 31, 32, 16));
+  BENCH("drawLine diagonal", 200000, u8g2_DrawLine(&u8g2, 0, loop_i & 63, 127, 63 - (loop_i & 63)));
+  BENCH("drawCircle r=20", 200000, u8g2_DrawCircle(&u8g2, 64, 32, 20, U8G2_DRAW_ALL));
+  BENCH("drawDisc r=20", 100000, u8g2_DrawDisc(&u8g2, 64, 32, 20, U8G2_DRAW_ALL));
+  BENCH("drawXBM 24x24 (coolant)", 100000, u8g2_DrawXBM(&u8g2, 104, 0, 24, 24, bmp_coolant));
+  BENCH("drawXBM 24x24 y=3", 100000, u8g2_DrawXBM(&u8g2, 100, 3, 24, 24, bmp_coolant));
+  BENCH("drawCompiledBitmap 24x24", 100000, u8g2_DrawCompiledBitmap(&u8g2, 104, 0, cbmp_coolant));
+  BENCH("drawCompiledBitmap 24x24 y=3", 100000, u8g2_DrawCompiledBitmap(&u8g2, 100, 3, cbmp_coolant));
+  BENCH("drawTileImage 128x64 (audio)", 100000, draw_audio_screen(loop_i % 5));
+  BENCH("drawTileImagePart slide (audio)", 100000, draw_audio_slide(loop_i % 5, loop_i & 127));
+}
+
+static void bench_transfer(void)
+{
+  uint32_t i;
+  printf("Transfer (SSD1306 128x64, U8X8_I2C_DATA_CHUNK=%d)\n", U8X8_I2C_DATA_CHUNK);
+  
+  u8g2_SetShadowBuffer(&u8g2, NULL, 0);
+  u8g2_host_ResetBus();
+  for( i = 0; i < 10; i++ )
+  {
+    draw_audio_screen(i % 5);
+    u8g2_UpdateDisplayArea(&u8g2, 0, 0, 16, 8);
+  }
+  report_bus("tile rows (updateDisplayArea)", 10);
+  for( i = 0; i < 10; i++ )
+  {
+    draw_audio_screen(i % 5);
+    u8g2_SendBuffer(&u8g2);
+  }
+  report_bus("frame (sendBuffer)", 10);
+  
+  /* a small value changes, like the coolant temperature */
+  draw_shapes();
+  u8g2_SendBuffer(&u8g2);
+  u8g2_host_ResetBus();
+  for( i = 0; i < 10; i++ )
+  {
+    u8g2_SetDrawColor(&u8g2, 0);
+    u8g2_DrawBox(&u8g2, 93, 40, 35, 14);
+    u8g2_SetDrawColor(&u8g2, 1);
+    u8g2_DrawBox(&u8g2, 93, 40, 10 + i, 14);
+    u8g2_SendDirty(&u8g2);
+  }
+  report_bus("small change (sendDirty)", 10);
+  
+  u8g2_SetShadowBuffer(&u8g2, shadow, sizeof(shadow));
+  u8g2_SendBuffer(&u8g2);
+  u8g2_host_ResetBus();
+  for( i = 0; i < 10; i++ )
+  {
+    draw_shapes();
+    u8g2_DrawBox(&u8g2, 93, 40, 10 + i, 14);
+    u8g2_SendBuffer(&u8g2);
+  }
+  report_bus("full redraw (sendBuffer + shadow)", 10);
+  u8g2_SetShadowBuffer(&u8g2, NULL, 0);
+}
+
+static volatile float fmt_float = 8.4f;
+static char fmt_buf[U8X8_FIXED_BUF_LEN];
+
+static void bench_format(void)
+{
+  printf("Formatting\n");
+  BENCH("sprintf \"%d\"", 1000000, snprintf(fmt_buf, sizeof(fmt_buf), "%d", (int)(682 - loop_i)));
+  BENCH("u8x8_s32tofixp 682", 1000000, u8x8_s32tofixp(fmt_buf, 682 - loop_i, 0, 0, ' '));
+  BENCH("sprintf \"%.1f\"", 1000000, snprintf(fmt_buf, sizeof(fmt_buf), "%.1f", fmt_float + loop_i));
+  BENCH("u8x8_s32tofixp 8.4 (from float)", 1000000, 
+    u8x8_s32tofixp(fmt_buf, (int32_t)((fmt_float + loop_i)*10 + 0.5f), 1, 0, ' '));
+  BENCH("sprintf \"%5d\"", 1000000, snprintf(fmt_buf, sizeof(fmt_buf), "%5d", (int)(loop_i & 1023)));
+  BENCH("u8x8_s32tofixp width=5", 1000000, u8x8_s32tofixp(fmt_buf, loop_i & 1023, 0, 5, ' '));
+}
+
+#ifndef U8G2_HOST_NO_FONTS
+static void bench_text(void)
+{
+  uint32_t lookups, decodes;
+  printf("Text\n");
+  u8g2_SetFont(&u8g2, u8g2_font_7x13_tr);
+  BENCH("drawStr \"12.3\"", 200000, u8g2_DrawStr(&u8g2, 10, 30, "12.3"));
+  BENCH("getStrWidth \"12.3\"", 200000, u8g2_GetStrWidth(&u8g2, "12.3"));
+  BENCH("sprintf + drawStr 12.3", 200000, 
+    snprintf(fmt_buf, sizeof(fmt_buf), "%.1f", fmt_float + 3.9f); u8g2_DrawStr(&u8g2, 10, 30, fmt_buf));
+  BENCH("drawFixed 123,1", 200000, u8g2_DrawFixed(&u8g2, 10, 30, 123, 1, 0));
+  BENCH("getFixedWidth 123,1", 200000, u8g2_GetFixedWidth(&u8g2, 123, 1, 0));
+  BENCH("CarInfoDisplay legacy screen", 20000, draw_car_info_legacy(682 - (loop_i & 63), 8.4f, 6.1f + (loop_i & 7), 88));
+  BENCH("MUI menu", 20000, draw_mui());
+  
+  u8g2_font_stats_lookup_cnt = 0;
+  u8g2_font_stats_decode_cnt = 0;
+  draw_car_info_legacy(682, 8.4f, 6.1f, 88);
+  lookups = u8g2_font_stats_lookup_cnt;
+  decodes = u8g2_font_stats_decode_cnt;
+  printf("  %-34s %6lu glyph lookups %6lu glyph decodes\n", "CarInfoDisplay legacy per frame", (unsigned long)lookups, (unsigned long)decodes);
+}
+#endif /* U8G2_HOST_NO_FONTS */
+
+/*===============================================*/
+/* golden images */
+
+static void render_screen(const char *name)
+{
+  uint8_t i;
+  for( i = 0; i < sizeof(audio_screens)/sizeof(*audio_screens); i++ )
+    if ( strcmp(name, audio_screens[i].name) == 0 )
+      draw_audio_screen(i);
+  if ( strcmp(name, "shapes") == 0 )
+    draw_shapes();
+#ifndef U8G2_HOST_NO_FONTS
+  if ( strcmp(name, "carinfo") == 0 )
+    draw_car_info_legacy(682, 8.4f, 6.1f, 88);
+  if ( strcmp(name, "mui_settings") == 0 )
+    draw_mui();
+#endif
+  u8g2_SendBuffer(&u8g2);
+}
+
+static const char *screen_names[] = {
+  "audio_bluetooth", "audio_aux", "audio_lightning", "audio_usb", "audio_carputer", "shapes",
+#ifndef U8G2_HOST_NO_FONTS
+  "carinfo", "mui_settings",
+#endif
+};
+
+static int golden(const char *dir, int is_check)
+{
+  char path[256];
+  uint8_t i;
+  int r, failed = 0;
+  for( i = 0; i < sizeof(screen_names)/sizeof(*screen_names); i++ )
+  {
+    render_screen(screen_names[i]);
+    snprintf(path, sizeof(path), "%s/%s.pbm", dir, screen_names[i]);
+    if ( is_check == 0 )
+    {
+      if ( u8g2_host_WritePBM(path) != 0 )
+      {
+	printf("can not write %s\n", path);
+	return 1;
+      }
+      printf("wrote %s\n", path);
+      continue;
+    }
+    r = u8g2_host_ComparePBM(path);
+    printf("%-20s %s\n", screen_names[i], r == 0 ? "ok" : (r < 0 ? "missing (make golden)" : "DIFFERENT"));
+    if ( r > 0 )
+      failed = 1;
+  }
+  return failed;
+}
+
+int main(int argc, char **argv)
+{
+  u8g2_Setup_ssd1306_i2c_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_host_ssd1306_i2c, u8x8_gpio_and_delay_host);
+  u8g2_InitDisplay(&u8g2);
+  u8g2_SetPowerSave(&u8g2, 0);
+#ifndef U8G2_HOST_NO_FONTS
+  mui_Init(&mui, &u8g2, fds_data, muif_list, sizeof(muif_list)/sizeof(muif_t));
+  mui_GotoForm(&mui, 1, 0);
+#endif
+  
+  if ( argc == 3 && strcmp(argv[1], "--dump") == 0 )
+    return golden(argv[2], 0);
+  if ( argc == 3 && strcmp(argv[1], "--check") == 0 )
+    return golden(argv[2], 1);
+  if ( argc != 1 )
+  {
+    printf("usage: %s [--dump <dir> | --check <dir>]\n", argv[0]);
+    return 2;
+  }
+  
+  bench_primitives();
+  bench_transfer();
+  bench_format();
+#ifndef U8G2_HOST_NO_FONTS
+  bench_text();
+#else
+  printf("Text\n  skipped, clib/u8g2_fonts.c is not available\n");
+#endif
+  return 0;
+}
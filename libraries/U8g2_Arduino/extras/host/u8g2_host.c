@@ -0,0 +1,190 @@
+/*
+
+  u8g2_host.c
+  
+  SSD1306 I2C emulation and bus statistics, see u8g2_host.h
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "u8g2_host.h"
+
+u8g2_host_bus_t u8g2_host_bus;
+
+static uint8_t host_ram[U8G2_HOST_WIDTH*U8G2_HOST_HEIGHT/8];
+static uint8_t host_col, host_page;
+static uint8_t host_col_start = 0, host_col_end = U8G2_HOST_WIDTH-1;
+static uint8_t host_page_start = 0, host_page_end = U8G2_HOST_HEIGHT/8-1;
+
+/* current transfer, the SSD13xx CAD procedures never send more than U8X8_I2C_DATA_CHUNK+1 bytes */
+static uint8_t host_transfer[256];
+static uint16_t host_transfer_len;
+
+/* command with arguments */
+static uint8_t host_cmd[3];
+static uint8_t host_cmd_len, host_cmd_args;
+
+static void host_command(uint8_t c)
+{
+  if ( host_cmd_args > 0 )
+  {
+    host_cmd[host_cmd_len++] = c;
+    host_cmd_args--;
+    if ( host_cmd_args > 0 )
+      return;
+    if ( host_cmd[0] == 0x21 )
+    {
+      host_col_start = host_cmd[1] & 127;
+      host_col_end = host_cmd[2] & 127;
+      host_col = host_col_start;
+    }
+    else if ( host_cmd[0] == 0x22 )
+    {
+      host_page_start = host_cmd[1] & 7;
+      host_page_end = host_cmd[2] & 7;
+      host_page = host_page_start;
+    }
+    return;
+  }
+  
+  host_cmd[0] = c;
+  host_cmd_len = 1;
+  switch(c)
+  {
+    case 0x21: case 0x22: case 0x26: case 0x27: case 0xa3:
+      host_cmd_args = 2;
+      break;
+    case 0x20: case 0x81: case 0x8d: case 0xa8: case 0xd3: case 0xd5: case 0xd9: case 0xda: case 0xdb:
+      host_cmd_args = 1;
+      break;
+    default:
+      if ( c >= 0xb0 && c <= 0xb7 )
+	host_page = c & 7;
+      else if ( c < 0x10 )
+	host_col = (host_col & 0xf0) | c;
+      else if ( c < 0x20 )
+	host_col = (host_col & 0x0f) | ((c & 7) << 4);
+      break;
+  }
+}
+
+static void host_data(uint8_t d)
+{
+  host_ram[host_page*U8G2_HOST_WIDTH + host_col] = d;
+  u8g2_host_bus.data_bytes++;
+  if ( host_col >= host_col_end )
+  {
+    host_col = host_col_start;
+    host_page = host_page >= host_page_end ? host_page_start : host_page+1;
+  }
+  else
+  {
+    host_col++;
+  }
+}
+
+uint8_t u8x8_byte_host_ssd1306_i2c(U8X8_UNUSED u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  uint16_t i;
+  switch(msg)
+  {
+    case U8X8_MSG_BYTE_SEND:
+      if ( host_transfer_len + arg_int > sizeof(host_transfer) )
+	return 0;
+      memcpy(host_transfer + host_transfer_len, arg_ptr, arg_int);
+      host_transfer_len += arg_int;
+      break;
+    case U8X8_MSG_BYTE_INIT:
+    case U8X8_MSG_BYTE_SET_DC:
+      break;
+    case U8X8_MSG_BYTE_START_TRANSFER:
+      host_transfer_len = 0;
+      break;
+    case U8X8_MSG_BYTE_END_TRANSFER:
+      u8g2_host_bus.transactions++;
+      u8g2_host_bus.bytes += host_transfer_len + 1;
+      /* first byte is the control byte: 0x00 commands, 0x40 data */
+      for( i = 1; i < host_transfer_len; i++ )
+      {
+	if ( host_transfer[0] == 0x40 )
+	  host_data(host_transfer[i]);
+	else
+	  host_command(host_transfer[i]);
+      }
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
+uint8_t u8x8_gpio_and_delay_host(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
+{
+  return 1;
+}
+
+void u8g2_host_ResetBus(void)
+{
+  memset(&u8g2_host_bus, 0, sizeof(u8g2_host_bus));
+}
+
+uint32_t u8g2_host_GetBusTimeUS(uint32_t bus_clock)
+{
+  uint64_t clocks = (uint64_t)u8g2_host_bus.bytes*9 + (uint64_t)u8g2_host_bus.transactions*2;
+  return (uint32_t)(clocks*1000000UL/bus_clock);
+}
+
+const uint8_t *u8g2_host_GetDisplayRAM(void)
+{
+  return host_ram;
+}
+
+/* P4 rows, MSB is the leftmost pixel */
+static void host_pbm_row(uint8_t *row, uint8_t y)
+{
+  uint8_t x;
+  memset(row, 0, U8G2_HOST_WIDTH/8);
+  for( x = 0; x < U8G2_HOST_WIDTH; x++ )
+    if ( host_ram[(y>>3)*U8G2_HOST_WIDTH + x] & (1<<(y&7)) )
+      row[x>>3] |= 0x80 >> (x&7);
+}
+
+int u8g2_host_WritePBM(const char *path)
+{
+  uint8_t row[U8G2_HOST_WIDTH/8];
+  uint8_t y;
+  FILE *fp = fopen(path, "wb");
+  if ( fp == NULL )
+    return -1;
+  fprintf(fp, "P4\n%d %d\n", U8G2_HOST_WIDTH, U8G2_HOST_HEIGHT);
+  for( y = 0; y < U8G2_HOST_HEIGHT; y++ )
+  {
+    host_pbm_row(row, y);
+    fwrite(row, 1, sizeof(row), fp);
+  }
+  fclose(fp);
+  return 0;
+}
+
+int u8g2_host_ComparePBM(const char *path)
+{
+  char header[32];
+  uint8_t row[U8G2_HOST_WIDTH/8], golden[U8G2_HOST_WIDTH/8];
+  uint8_t y;
+  int result = 0;
+  FILE *fp = fopen(path, "rb");
+  if ( fp == NULL )
+    return -1;
+  snprintf(header, sizeof(header), "P4\n%d %d\n", U8G2_HOST_WIDTH, U8G2_HOST_HEIGHT);
+  if ( fread(golden, 1, strlen(header), fp) != strlen(header) || memcmp(golden, header, strlen(header)) != 0 )
+    result = 1;
+  for( y = 0; y < U8G2_HOST_HEIGHT && result == 0; y++ )
+  {
+    host_pbm_row(row, y);
+    if ( fread(golden, 1, sizeof(golden), fp) != sizeof(golden) || memcmp(row, golden, sizeof(row)) != 0 )
+      result = 1;
+  }
+  fclose(fp);
+  return result;
+}
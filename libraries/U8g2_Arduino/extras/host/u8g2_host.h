@@ -0,0 +1,47 @@
+/*
+
+  u8g2_host.h
+  
+  Linux backend for the u8g2 C library, used by the benchmark in this folder.
+  
+  u8x8_byte_host_ssd1306_i2c() is a byte procedure which counts the I2C traffic
+  and decodes it like a SSD1306 controller: commands move the RAM pointer,
+  data bytes go into an emulated 128x64 display RAM. So the result of a 
+  transfer can be checked (and written to a PBM file) exactly as it would 
+  appear on the display.
+
+*/
+
+#ifndef U8G2_HOST_H
+#define U8G2_HOST_H
+
+#include "u8g2.h"
+
+#define U8G2_HOST_WIDTH 128
+#define U8G2_HOST_HEIGHT 64
+
+typedef struct
+{
+  uint32_t transactions;	/* start ... stop */
+  uint32_t bytes;		/* all bytes on the bus, including the address byte of each transaction */
+  uint32_t data_bytes;		/* bytes written to the display RAM */
+} u8g2_host_bus_t;
+
+extern u8g2_host_bus_t u8g2_host_bus;
+
+uint8_t u8x8_byte_host_ssd1306_i2c(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+uint8_t u8x8_gpio_and_delay_host(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
+
+void u8g2_host_ResetBus(void);
+/* estimated transfer time: 9 clocks per byte, 2 for start and stop */
+uint32_t u8g2_host_GetBusTimeUS(uint32_t bus_clock);
+
+/* emulated display RAM, SSD1306 layout (pages of 8 pixel rows, LSB on top) */
+const uint8_t *u8g2_host_GetDisplayRAM(void);
+
+/* PBM (P4) files of the display RAM, 1 is a pixel which is on */
+int u8g2_host_WritePBM(const char *path);
+/* returns 0 if the file matches the display RAM, 1 if it differs, -1 if it can not be read */
+int u8g2_host_ComparePBM(const char *path);
+
+#endif /* U8G2_HOST_H */
@@ -0,0 +1,304 @@
+# Convert 1 bit images into the tile layout used by u8g2 full buffers of
+# SSD13xx/SH110x style displays (u8g2_ll_hvline_vertical_top_lsb):
+# one byte covers 8 vertical pixels, LSB on top, tiles ordered left to right,
+# tile rows top to bottom. The output can be passed straight to
+# u8g2.drawTileImage() which only has to memcpy it into the frame buffer.
+#
+# Inputs can be:
+#   - PNG files (any bit depth / color type, not interlaced)
+#   - XBM arrays inside a C/C++ source in image2cpp style:
+#         // 'D_Aux', 128x64px
+#         const unsigned char bmp_D_Aux[] PROGMEM = { ... };
+#     given as "file.ino:bmp_D_Aux" (width/height are read from the comment,
+#     or can be forced with --size WxH)
+#
+# With --compiled the images are written for u8g2.drawCompiledBitmap(), which
+# draws at any pixel position: width and height bytes followed by the same
+# vertical bytes, without padding the width to whole tiles.
+# With --atlas NAME all images go into one compiled atlas for
+# u8g2.drawAtlasBitmap(), identical images are only stored once.
+#
+# Usage:
+#   python bmp2tiles.py -o Screens.h D_Aux.png D_Bluetooth.png ...
+#   python bmp2tiles.py -o Icons.h --prefix tiles_ Sketch.ino:bmp_coolant
+#   python bmp2tiles.py -o Icons.h --compiled Sketch.ino:bmp_coolant
+#   python bmp2tiles.py -o Icons.h --atlas icons coolant.png oil.png fuel.png
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = None
+    trns = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif kind == b"tRNS":
+            trns = chunk
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError(f"{path}: interlaced PNGs are not supported")
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    bpp = max(1, bits_per_pixel // 8)  # filter unit in bytes
+    raw = zlib.decompress(idat)
+
+    # Undo the per-scanline filters
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        start = y * (stride + 1)
+        ftype = raw[start]
+        line = bytearray(raw[start + 1:start + 1 + stride])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def sample(line, index):
+        # Returns sample number "index" of a scanline, scaled to 0..255
+        if depth == 16:
+            return line[index * 2]
+        if depth == 8:
+            return line[index]
+        per_byte = 8 // depth
+        shift = 8 - depth * (index % per_byte + 1)
+        value = (line[index // per_byte] >> shift) & ((1 << depth) - 1)
+        return value if color == 3 else value * 255 // ((1 << depth) - 1)
+
+    # A pixel is "on" if it is bright and not transparent
+    pixels = []
+    for line in rows:
+        out = []
+        for x in range(width):
+            s = [sample(line, x * channels + c) for c in range(channels)]
+            alpha = 255
+            if color == 3:
+                index = s[0]
+                r, g, b = palette[index]
+                if trns is not None and index < len(trns):
+                    alpha = trns[index]
+            elif color in (0, 4):
+                r = g = b = s[0]
+                if color == 4:
+                    alpha = s[1]
+            else:
+                r, g, b = s[0], s[1], s[2]
+                if color == 6:
+                    alpha = s[3]
+            luma = (r * 299 + g * 587 + b * 114) // 1000
+            out.append(1 if alpha >= 128 and luma >= 128 else 0)
+        pixels.append(out)
+    return width, height, pixels
+
+
+def read_xbm_array(path, name, size=None):
+    with open(path, "r") as f:
+        text = f.read()
+
+    match = re.search(r"\b" + re.escape(name) + r"\s*\[\s*\]\s*[^=]*=\s*\{([^}]*)\}", text)
+    if not match:
+        raise ValueError(f"{path}: array '{name}' not found")
+    data = [int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{1,2})", match.group(1))]
+
+    if size is None:
+        # image2cpp writes "// 'name', WxHpx" right above the array
+        line_start = text.rfind("\n", 0, match.start()) + 1
+        before = text[:line_start].rstrip().splitlines()
+        dims = re.search(r"(\d+)x(\d+)px", before[-1]) if before else None
+        if not dims:
+            raise ValueError(f"{path}: size of '{name}' unknown, use --size WxH")
+        size = (int(dims.group(1)), int(dims.group(2)))
+    width, height = size
+
+    stride = (width + 7) // 8
+    if len(data) != stride * height:
+        raise ValueError(f"{path}: '{name}' has {len(data)} bytes, expected {stride * height}")
+
+    # XBM: rows top to bottom, LSB is the leftmost pixel
+    pixels = []
+    for y in range(height):
+        pixels.append([(data[y * stride + x // 8] >> (x & 7)) & 1 for x in range(width)])
+    return width, height, pixels
+
+
+def to_tiles(width, height, pixels):
+    # Pad to whole tiles, the padding stays off
+    tile_width = (width + 7) // 8
+    tile_height = (height + 7) // 8
+    out = bytearray()
+    for ty in range(tile_height):
+        for x in range(tile_width * 8):
+            byte = 0
+            for bit in range(8):
+                y = ty * 8 + bit
+                if x < width and y < height and pixels[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return tile_width, tile_height, out
+
+
+def to_compiled(width, height, pixels):
+    # Format of u8g2_DrawCompiledBitmap(): width, height, (height+7)/8 rows of width bytes
+    if width > 255 or height > 255:
+        raise ValueError(f"compiled bitmaps are limited to 255x255, got {width}x{height}")
+    out = bytearray([width, height])
+    for ty in range((height + 7) // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = ty * 8 + bit
+                if y < height and pixels[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def to_atlas(bitmaps):
+    # Format of u8g2_DrawAtlasBitmap(): count, 16 bit offsets (low byte first), compiled bitmaps
+    header = 1 + 2 * len(bitmaps)
+    offsets = []
+    body = bytearray()
+    stored = {}
+    for data in bitmaps:
+        key = bytes(data)
+        if key not in stored:
+            stored[key] = header + len(body)
+            body += data
+        offsets.append(stored[key])
+    if header + len(body) > 0xFFFF:
+        raise ValueError("atlas is larger than 64 KB")
+    out = bytearray([len(bitmaps)])
+    for offset in offsets:
+        out += bytes([offset & 0xFF, offset >> 8])
+    return out + body
+
+
+def c_identifier(text):
+    ident = re.sub(r"\W", "_", text)
+    return "_" + ident if ident[0].isdigit() else ident
+
+
+def format_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + ",")
+    return f"const unsigned char {name}[] PROGMEM = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert images to u8g2 vertical tile layout")
+    parser.add_argument("inputs", nargs="+", help="image.png or source.ino:xbm_array_name")
+    parser.add_argument("-o", "--output", required=True, help="header file to write")
+    parser.add_argument("--prefix", default="tiles_", help="prefix for the generated array names")
+    parser.add_argument("--size", help="force WxH for XBM inputs")
+    parser.add_argument("--compiled", action="store_true", help="write compiled bitmaps for drawCompiledBitmap()")
+    parser.add_argument("--atlas", metavar="NAME", help="write all images into one atlas for drawAtlasBitmap()")
+    args = parser.parse_args()
+    if args.atlas and len(args.inputs) > 255:
+        parser.error("an atlas holds at most 255 images")
+    # Everything that changes the output goes into the "Regenerate with" line
+    options = []
+    if args.compiled:
+        options.append("--compiled")
+    if args.atlas:
+        options += ["--atlas", args.atlas]
+    if args.prefix != parser.get_default("prefix"):
+        options += ["--prefix", args.prefix]
+    if args.size:
+        options += ["--size", args.size]
+    if args.prefix == parser.get_default("prefix") and (args.compiled or args.atlas):
+        args.prefix = "cbmp_"
+
+    size = tuple(int(v) for v in args.size.split("x")) if args.size else None
+    guard = c_identifier(os.path.basename(args.output)).upper()
+
+    out = []
+    out.append(f"// Generated by U8g2_Arduino/extras/tools/bmp2tiles.py, do not edit. Regenerate with:")
+    command = ["python bmp2tiles.py", "-o", os.path.basename(args.output)] + options
+    out.append("//   " + " ".join(command + [os.path.basename(i) for i in args.inputs]))
+    if args.atlas:
+        out.append(f"// Layout: atlas of compiled bitmaps, see u8g2_DrawAtlasBitmap()")
+    elif args.compiled:
+        out.append(f"// Layout: compiled bitmaps (width, height, vertical bytes with LSB on top), see u8g2_DrawCompiledBitmap()")
+    else:
+        out.append(f"// Layout: vertical tiles, LSB on top (u8g2 full buffer layout of SSD13xx displays)")
+    out.append(f"")
+    out.append(f"#ifndef {guard}")
+    out.append(f"#define {guard}")
+    out.append(f"")
+
+    atlas = []
+    for source in args.inputs:
+        if source.lower().endswith(".png"):
+            width, height, pixels = read_png(source)
+            name = os.path.splitext(os.path.basename(source))[0]
+        else:
+            path, _, array = source.rpartition(":")
+            width, height, pixels = read_xbm_array(path, array, size)
+            name = re.sub(r"^(bmp|epd_bitmap)_", "", array)
+
+        ident = c_identifier(args.prefix + name)
+        if args.atlas:
+            index = len(atlas)
+            atlas.append(to_compiled(width, height, pixels))
+            out.append(f"#define {c_identifier(args.atlas + '_' + name).upper()} {index} // {width}x{height}px")
+        elif args.compiled:
+            out.append(f"// '{name}', {width}x{height}px")
+            out.append(format_array(ident, to_compiled(width, height, pixels)))
+        else:
+            tile_width, tile_height, data = to_tiles(width, height, pixels)
+            out.append(f"// '{name}', {width}x{height}px, {tile_width}x{tile_height} tiles")
+            out.append(f"#define {ident.upper()}_TILE_WIDTH {tile_width}")
+            out.append(f"#define {ident.upper()}_TILE_HEIGHT {tile_height}")
+            out.append(format_array(ident, data))
+
+    if args.atlas:
+        out.append(f"#define {c_identifier(args.atlas).upper()}_COUNT {len(atlas)}")
+        out.append(format_array(c_identifier(args.atlas), to_atlas(atlas)))
+
+    out.append(f"#endif")
+
+    with open(args.output, "w", newline="\n") as f:
+        f.write("\n".join(out) + "\n")
+    print(f"Wrote {args.output}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -73,4 +73,160 @@ void U8G2::writeBufferXBM2(Print &p)
 }
 #endif
 
+/*=============================================*/
+/* asynchronous transfer of the full buffer */
 
+#ifdef U8G2_WITH_ASYNC_FLUSH
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#ifndef U8G2_ASYNC_FLUSH_STACK
+#define U8G2_ASYNC_FLUSH_STACK 3072
+#endif
+#ifndef U8G2_ASYNC_FLUSH_PRIORITY
+#define U8G2_ASYNC_FLUSH_PRIORITY 1
+#endif
+
+/*
+  "flush" is a copy of the u8g2 struct, but with tile_buf_ptr pointing to
+  "snapshot". The flush task only uses this copy, so the application can 
+  draw into the original buffer while the snapshot is transfered.
+  The shadow buffer (if any) is only accessed by the flush task.
+  The task never writes to the application's u8g2 struct: the results of a
+  transfer stay in "flush" and are merged by waitFlush() or the next
+  sendBufferAsync(), on the caller's thread.
+*/
+
+/* is_shadow_valid while a transfer runs, reset to 0 if the shadow is invalidated meanwhile */
+#define U8G2_SHADOW_VALID_PENDING 2
+
+struct u8g2_async_flush_struct
+{
+  u8g2_t *u8g2;
+  u8g2_t flush;
+  uint8_t *snapshot;
+  uint16_t snapshot_size;
+  TaskHandle_t task;
+  SemaphoreHandle_t idle;	/* taken while a transfer is pending */
+  u8g2_flush_cb cb;
+  void *arg;
+  uint8_t has_result;	/* "flush" holds results which are not merged yet */
+};
+
+static void u8g2_async_flush_task(void *param)
+{
+  struct u8g2_async_flush_struct *a = (struct u8g2_async_flush_struct *)param;
+  for(;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    u8g2_SendBuffer(&(a->flush));
+    if ( a->cb != NULL )
+      a->cb(a->arg);
+    xSemaphoreGive(a->idle);
+  }
+}
+
+/* caller's thread, "idle" must be held: copy the results of the last transfer back */
+static void u8g2_async_flush_merge(struct u8g2_async_flush_struct *a)
+{
+  if ( a->has_result == 0 )
+    return;
+  a->has_result = 0;
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  if ( a->u8g2->is_shadow_valid == U8G2_SHADOW_VALID_PENDING )
+    a->u8g2->is_shadow_valid = a->flush.is_shadow_valid;
+#endif
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  a->u8g2->dirty_bytes_saved += a->flush.dirty_bytes_saved;
+#endif
+}
+
+/* returns NULL if there is not enough memory, sendBufferAsync() is synchronous then */
+static struct u8g2_async_flush_struct *u8g2_async_flush_create(u8g2_t *u8g2)
+{
+  struct u8g2_async_flush_struct *a;
+  
+  a = (struct u8g2_async_flush_struct *)calloc(1, sizeof(struct u8g2_async_flush_struct));
+  if ( a == NULL )
+    return NULL;
+  a->u8g2 = u8g2;
+  a->snapshot_size = (uint16_t)u8g2_GetBufferTileHeight(u8g2) * u8g2_GetBufferTileWidth(u8g2) * 8;
+  a->snapshot = (uint8_t *)malloc(a->snapshot_size);
+  a->idle = xSemaphoreCreateBinary();
+  if ( a->snapshot != NULL && a->idle != NULL )
+  {
+    xSemaphoreGive(a->idle);
+    if ( xTaskCreate(u8g2_async_flush_task, "u8g2_flush", U8G2_ASYNC_FLUSH_STACK, a, U8G2_ASYNC_FLUSH_PRIORITY, &(a->task)) == pdPASS )
+      return a;
+  }
+  if ( a->idle != NULL )
+    vSemaphoreDelete(a->idle);
+  free(a->snapshot);
+  free(a);
+  return NULL;
+}
+#endif /* U8G2_WITH_ASYNC_FLUSH */
+
+/*
+  Same as sendBuffer(), but on ESP32 the buffer is copied and transfered by a
+  separate task: The application can draw the next frame while the display is
+  updated. If the previous transfer is still running, sendBufferAsync() waits
+  for it. "cb" is called after the transfer (from the flush task on ESP32).
+  Other u8g2 functions which talk to the display wait for the transfer, but
+  other devices on the same bus must be thread safe (ESP32 Wire is).
+  getDirtyBytesSaved() includes a transfer after waitFlush() or the next send.
+  Page buffer mode and other platforms: the buffer is sent immediately.
+*/
+void U8G2::sendBufferAsync(u8g2_flush_cb cb, void *arg)
+{
+#ifdef U8G2_WITH_ASYNC_FLUSH
+  if ( async_flush == NULL && u8g2_GetBufferTileHeight(&u8g2) >= u8x8_GetRows(u8g2_GetU8x8(&u8g2)) )
+    async_flush = u8g2_async_flush_create(&u8g2);
+  if ( async_flush != NULL )
+  {
+    xSemaphoreTake(async_flush->idle, portMAX_DELAY);
+    u8g2_async_flush_merge(async_flush);
+    async_flush->flush = u8g2;
+    async_flush->flush.tile_buf_ptr = async_flush->snapshot;
+#ifdef U8G2_WITH_DIRTY_TRACKING
+    async_flush->flush.dirty_bytes_saved = 0;
+    u8g2_ClearBufferDirty(&u8g2);		/* the snapshot contains all changes */
+#endif
+    memcpy(async_flush->snapshot, u8g2.tile_buf_ptr, async_flush->snapshot_size);
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    if ( u8g2.shadow_buf_ptr != NULL )
+      u8g2.is_shadow_valid = U8G2_SHADOW_VALID_PENDING;
+#endif
+    async_flush->cb = cb;
+    async_flush->arg = arg;
+    async_flush->has_result = 1;
+    xTaskNotifyGive(async_flush->task);
+    return;
+  }
+#endif /* U8G2_WITH_ASYNC_FLUSH */
+  u8g2_SendBuffer(&u8g2);
+  if ( cb != NULL )
+    cb(arg);
+}
+
+bool U8G2::isFlushing(void)
+{
+#ifdef U8G2_WITH_ASYNC_FLUSH
+  if ( async_flush != NULL )
+    return uxSemaphoreGetCount(async_flush->idle) == 0;
+#endif
+  return false;
+}
+
+void U8G2::waitFlush(void)
+{
+#ifdef U8G2_WITH_ASYNC_FLUSH
+  if ( async_flush != NULL )
+  {
+    xSemaphoreTake(async_flush->idle, portMAX_DELAY);
+    u8g2_async_flush_merge(async_flush);
+    xSemaphoreGive(async_flush->idle);
+  }
+#endif
+}
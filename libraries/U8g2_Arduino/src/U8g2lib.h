@@ -54,6 +54,18 @@
 
 #include "clib/u8g2.h"
 
+/*
+  sendBufferAsync() copies the full buffer into a second buffer and returns
+  immediately, a FreeRTOS task transfers the copy to the display. Only for ESP32,
+  other platforms send the buffer before sendBufferAsync() returns.
+*/
+#if defined(ARDUINO) && defined(ESP32) && !defined(U8G2_WITHOUT_ASYNC_FLUSH)
+#define U8G2_WITH_ASYNC_FLUSH
+#endif
+
+/* called after the transfer of sendBufferAsync(), on ESP32 from the flush task */
+typedef void (*u8g2_flush_cb)(void *arg);
+
 class U8G2
 #ifdef ARDUINO
 : public Print
@@ -62,15 +74,22 @@ class U8G2
   protected:
     u8g2_t u8g2;
     u8x8_char_cb cpp_next_cb; /*  the cpp interface has its own decoding function for the Arduino print command */
+#ifdef U8G2_WITH_ASYNC_FLUSH
+    struct u8g2_async_flush_struct *async_flush;	/* created by the first sendBufferAsync() */
+#endif
   public:
     u8g2_uint_t tx, ty;
   
+#ifdef U8G2_WITH_ASYNC_FLUSH
+    U8G2(void) { cpp_next_cb = u8x8_ascii_next; async_flush = NULL; home(); }
+#else
     U8G2(void) { cpp_next_cb = u8x8_ascii_next; home(); }
+#endif
     u8x8_t *getU8x8(void) { return u8g2_GetU8x8(&u8g2); }
     u8g2_t *getU8g2(void) { return &u8g2; }
     
     void sendF(const char *fmt, ...) 
-      { va_list va; va_start(va, fmt); u8x8_cad_vsendf(u8g2_GetU8x8(&u8g2), fmt, va); va_end(va); }
+      { va_list va; va_start(va, fmt); waitFlush(); u8x8_cad_vsendf(u8g2_GetU8x8(&u8g2), fmt, va); va_end(va); }
 
 
     uint32_t getBusClock(void) { return u8g2_GetU8x8(&u8g2)->bus_clock; }
@@ -86,7 +105,7 @@ class U8G2
     uint8_t getCols(void) { return u8x8_GetCols(u8g2_GetU8x8(&u8g2)); }
     uint8_t getRows(void) { return u8x8_GetRows(u8g2_GetU8x8(&u8g2)); }
     void drawTile(uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr) {
-      u8x8_DrawTile(u8g2_GetU8x8(&u8g2), x, y, cnt, tile_ptr); }
+      waitFlush(); u8x8_DrawTile(u8g2_GetU8x8(&u8g2), x, y, cnt, tile_ptr); }
 
 #ifdef U8X8_WITH_USER_PTR
       void *getUserPtr() { return u8g2_GetUserPtr(&u8g2); }
@@ -116,27 +135,27 @@ class U8G2
     uint8_t getMenuEvent(void) { return u8x8_GetMenuEvent(u8g2_GetU8x8(&u8g2)); }
 
     void initDisplay(void) {
-      u8g2_InitDisplay(&u8g2); }
+      waitFlush(); u8g2_InitDisplay(&u8g2); }
       
     /* call initInterface if the uC comes out of deep sleep mode and display is already running */
     /* initInterface is part if initDisplay, do not call both use either initDisplay OR initInterface */       
     void initInterface(void) {          
-      u8g2_InitInterface(&u8g2); }
+      waitFlush(); u8g2_InitInterface(&u8g2); }
       
     void clearDisplay(void) {
-      u8g2_ClearDisplay(&u8g2); }
+      waitFlush(); u8g2_ClearDisplay(&u8g2); }
       
     void setPowerSave(uint8_t is_enable) {
-      u8g2_SetPowerSave(&u8g2, is_enable); }
+      waitFlush(); u8g2_SetPowerSave(&u8g2, is_enable); }
       
     void setFlipMode(uint8_t mode) {
-      u8g2_SetFlipMode(&u8g2, mode); }
+      waitFlush(); u8g2_SetFlipMode(&u8g2, mode); }
 
     void setContrast(uint8_t value) {
-      u8g2_SetContrast(&u8g2, value); }
+      waitFlush(); u8g2_SetContrast(&u8g2, value); }
       
     void setDisplayRotation(const u8g2_cb_t *u8g2_cb) {
-      u8g2_SetDisplayRotation(&u8g2, u8g2_cb); }
+      waitFlush(); u8g2_SetDisplayRotation(&u8g2, u8g2_cb); }
       
     
 
@@ -184,9 +203,14 @@ class U8G2
 
     
     /* u8g2_buffer.c */
-    void sendBuffer(void) { u8g2_SendBuffer(&u8g2); }
+    void sendBuffer(void) { waitFlush(); u8g2_SendBuffer(&u8g2); }
     void clearBuffer(void) { u8g2_ClearBuffer(&u8g2); }    
     
+    /* U8g2lib.cpp: the buffer can be modified again as soon as sendBufferAsync() returns */
+    void sendBufferAsync(u8g2_flush_cb cb = NULL, void *arg = NULL);
+    bool isFlushing(void);
+    void waitFlush(void);
+    
     void firstPage(void) { u8g2_FirstPage(&u8g2); }
     uint8_t nextPage(void) { return u8g2_NextPage(&u8g2); }
     
@@ -206,11 +230,31 @@ class U8G2
     void setAutoPageClear(uint8_t mode)  { u8g2_SetAutoPageClear(&u8g2, mode); }
     
     void updateDisplayArea(uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th)
-      { u8g2_UpdateDisplayArea(&u8g2, tx, ty, tw, th); }
+      { waitFlush(); u8g2_UpdateDisplayArea(&u8g2, tx, ty, tw, th); }
     void updateDisplay(void)
-      { u8g2_UpdateDisplay(&u8g2); }
+      { waitFlush(); u8g2_UpdateDisplay(&u8g2); }
+    void drawTileImage(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th, const uint8_t *tiles)
+      { u8g2_DrawTileImage(&u8g2, tx, ty, tw, th, tiles); }
+    void drawTileImagePart(u8g2_uint_t x, uint8_t ty, u8g2_uint_t w, uint8_t th, const uint8_t *tiles, uint8_t tw, u8g2_uint_t src_x)
+      { u8g2_DrawTileImagePart(&u8g2, x, ty, w, th, tiles, tw, src_x); }
+    
+    /* u8g2_dirty.c */
+    void sendDirty(void) { waitFlush(); u8g2_SendDirty(&u8g2); }
+#ifdef U8G2_WITH_DIRTY_TRACKING
+    void markDirtyTiles(uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+      { u8g2_MarkDirtyTiles(&u8g2, tx, ty, tw, th); }
+    void setBufferDirty(void) { u8g2_SetBufferDirty(&u8g2); }
+    uint8_t isBufferDirty(void) { return u8g2_IsBufferDirty(&u8g2); }
+    uint32_t getDirtyBytesSaved(void) { return u8g2_GetDirtyBytesSaved(&u8g2); }
+    void resetDirtyBytesSaved(void) { u8g2_ResetDirtyBytesSaved(&u8g2); }
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    bool setShadowBuffer(uint8_t *buf, uint16_t size) { waitFlush(); return u8g2_SetShadowBuffer(&u8g2, buf, size) != 0; }
+    uint16_t getShadowBufferSize(void) { return u8g2_GetShadowBufferSize(&u8g2); }
+    void invalidateShadowBuffer(void) { u8g2_InvalidateShadowBuffer(&u8g2); }
+#endif
     void refreshDisplay(void)
-      { u8x8_RefreshDisplay(u8g2_GetU8x8(&u8g2)); }
+      { waitFlush(); u8x8_RefreshDisplay(u8g2_GetU8x8(&u8g2)); }
     
 
 
@@ -255,6 +299,11 @@ class U8G2
       { u8g2_DrawXBM(&u8g2, x, y, w, h, bitmap); }
     void drawXBMP(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
       { u8g2_DrawXBMP(&u8g2, x, y, w, h, bitmap); }
+    /* bitmaps from extras/tools/bmp2tiles.py --compiled / --atlas, see u8g2_bitmap.c */
+    void drawCompiledBitmap(u8g2_uint_t x, u8g2_uint_t y, const uint8_t *bitmap)
+      { u8g2_DrawCompiledBitmap(&u8g2, x, y, bitmap); }
+    void drawAtlasBitmap(u8g2_uint_t x, u8g2_uint_t y, const uint8_t *atlas, uint8_t index)
+      { u8g2_DrawAtlasBitmap(&u8g2, x, y, atlas, index); }
     
     
     /* u8g2_polygon.c */
@@ -298,10 +347,20 @@ u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str);
     u8g2_uint_t drawUTF8X2(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawUTF8X2(&u8g2, x, y, s); }
     u8g2_uint_t drawExtUTF8(u8g2_uint_t x, u8g2_uint_t y, uint8_t to_left, const uint16_t *kerning_table, const char *s) 
       { return u8g2_DrawExtUTF8(&u8g2, x, y, to_left, kerning_table, s); }
+    /* fixed point without printf: drawFixed(x, y, 84, 1) draws "8.4", see u8x8_s32tofixp() */
+    u8g2_uint_t drawFixed(u8g2_uint_t x, u8g2_uint_t y, int32_t v, uint8_t decimals, uint8_t width = 0)
+      { return u8g2_DrawFixed(&u8g2, x, y, v, decimals, width); }
 
       
     u8g2_uint_t getStrWidth(const char *s) { return u8g2_GetStrWidth(&u8g2, s); }
     u8g2_uint_t getUTF8Width(const char *s) { return u8g2_GetUTF8Width(&u8g2, s); }
+    u8g2_uint_t getFixedWidth(int32_t v, uint8_t decimals, uint8_t width = 0) { return u8g2_GetFixedWidth(&u8g2, v, decimals, width); }
+    /* scale a float for the fixed point functions: toFixed(8.37, 1) = 84 */
+    static int32_t toFixed(float v, uint8_t decimals) {
+      while( decimals-- > 0 )
+	v *= 10;
+      return (int32_t)(v < 0 ? v - 0.5f : v + 0.5f);
+    }
     
     int8_t getXOffsetGlyph(uint16_t encoding) { return u8g2_GetXOffsetGlyph(&u8g2, encoding); }
     int8_t getXOffsetUTF8(const char *utf8) { return u8g2_GetXOffsetUTF8(&u8g2, utf8); }
@@ -369,6 +428,12 @@ u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str);
       }
       return cnt;
     }
+
+    /* print() for fixed point values, avoids the float path of print()/sprintf(): printFixed(toFixed(fuel, 1), 1) */
+    size_t printFixed(int32_t v, uint8_t decimals, uint8_t width = 0) {
+      char buf[U8X8_FIXED_BUF_LEN];
+      return write((const uint8_t *)buf, u8x8_s32tofixp(buf, v, decimals, width, ' '));
+    }
  
 
      /* user interface */
@@ -28648,5 +28713,25 @@ class U8G2_BITMAP : public U8G2 {
   }
 };
 
+#ifdef U8G2_WITH_SHADOW_BUFFER
+/*
+  Adds a shadow of the display RAM to any full buffer constructor, so that 
+  sendBuffer() only transfers the tiles which have changed since the last transfer:
+    U8G2_SHADOW<U8G2_SSD1306_128X64_NONAME_F_HW_I2C> u8g2(U8G2_R0, U8X8_PIN_NONE);
+  SIZE must be at least getShadowBufferSize() (width*height/8), otherwise the
+  shadow is not used.
+*/
+template <class BASE, uint16_t SIZE = 1024>
+class U8G2_SHADOW : public BASE {
+  private:
+    uint8_t shadow_buf[SIZE];
+  public:
+    template <typename... Args>
+    U8G2_SHADOW(Args... args) : BASE(args...) {
+      u8g2_SetShadowBuffer(this->getU8g2(), shadow_buf, SIZE);
+    }
+};
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
 #endif /* _U8G2LIB_HH */
 
@@ -60,6 +60,13 @@
 
 #endif /* ARDUINO */ 
 
+/* the SSD13xx CAD procedures send U8X8_I2C_DATA_CHUNK data bytes plus the 0x40 control byte in one transfer */
+#if defined(I2C_BUFFER_LENGTH)
+static_assert(U8X8_I2C_DATA_CHUNK + 1 <= I2C_BUFFER_LENGTH, "U8X8_I2C_DATA_CHUNK does not fit into the Wire buffer");
+#elif defined(BUFFER_LENGTH)
+static_assert(U8X8_I2C_DATA_CHUNK + 1 <= BUFFER_LENGTH, "U8X8_I2C_DATA_CHUNK does not fit into the Wire buffer");
+#endif 
+
 
 
 /*=============================================*/
@@ -1329,6 +1336,11 @@ extern "C" uint8_t u8x8_byte_arduino_sw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSE
 /*=============================================*/
 /*=== HARDWARE I2C ===*/
 
+#ifdef U8X8_HAVE_HW_I2C
+/* last clock passed to Wire.setClock(), 0: unknown */
+static uint32_t u8x8_hw_i2c_clock = 0;
+#endif
+
 extern "C" uint8_t u8x8_byte_arduino_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
 {
 #ifdef U8X8_HAVE_HW_I2C
@@ -1340,6 +1352,7 @@ extern "C" uint8_t u8x8_byte_arduino_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSE
     case U8X8_MSG_BYTE_INIT:
       if ( u8x8->bus_clock == 0 ) 	/* issue 769 */
 	u8x8->bus_clock = u8x8->display_info->i2c_bus_clock_100kHz * 100000UL;
+      u8x8_hw_i2c_clock = 0;	/* Wire.begin() may reset the clock */
 #if defined(ESP8266) || defined(ARDUINO_ARCH_ESP8266) || defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
       /* for ESP8266/ESP32, Wire.begin has two more arguments: clock and data */          
       if ( u8x8->pins[U8X8_PIN_I2C_CLOCK] != U8X8_PIN_NONE && u8x8->pins[U8X8_PIN_I2C_DATA] != U8X8_PIN_NONE )
@@ -1363,7 +1376,15 @@ extern "C" uint8_t u8x8_byte_arduino_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSE
       /* if there is any error with Wire.setClock() just remove this function call by */
       /* defining U8X8_DO_NOT_SET_WIRE_CLOCK */
 #ifndef U8X8_DO_NOT_SET_WIRE_CLOCK
-      Wire.setClock(u8x8->bus_clock);
+      /* setClock() is slow on some platforms: only call it if the clock has changed */
+      /* define U8X8_ALWAYS_SET_WIRE_CLOCK if other devices on the bus change the clock */
+#ifndef U8X8_ALWAYS_SET_WIRE_CLOCK
+      if ( u8x8_hw_i2c_clock != u8x8->bus_clock )
+#endif
+      {
+	Wire.setClock(u8x8->bus_clock);
+	u8x8_hw_i2c_clock = u8x8->bus_clock;
+      }
 #endif 
 #endif
       Wire.beginTransmission(u8x8_GetI2CAddress(u8x8)>>1);
@@ -1378,6 +1399,11 @@ extern "C" uint8_t u8x8_byte_arduino_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSE
   return 1;
 }
 
+#ifdef U8X8_HAVE_2ND_HW_I2C
+/* last clock passed to Wire1.setClock(), 0: unknown */
+static uint32_t u8x8_2nd_hw_i2c_clock = 0;
+#endif
+
 extern "C" uint8_t u8x8_byte_arduino_2nd_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_UNUSED uint8_t msg, U8X8_UNUSED uint8_t arg_int, U8X8_UNUSED void *arg_ptr)
 {
 #ifdef U8X8_HAVE_2ND_HW_I2C
@@ -1389,6 +1415,7 @@ extern "C" uint8_t u8x8_byte_arduino_2nd_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_U
     case U8X8_MSG_BYTE_INIT:
       if ( u8x8->bus_clock == 0 ) 	/* issue 769 */
 	u8x8->bus_clock = u8x8->display_info->i2c_bus_clock_100kHz * 100000UL;
+      u8x8_2nd_hw_i2c_clock = 0;	/* Wire1.begin() may reset the clock */
       Wire1.begin();
       break;
     case U8X8_MSG_BYTE_SET_DC:
@@ -1399,7 +1426,15 @@ extern "C" uint8_t u8x8_byte_arduino_2nd_hw_i2c(U8X8_UNUSED u8x8_t *u8x8, U8X8_U
       /* if there is any error with Wire.setClock() just remove this function call by */
       /* defining U8X8_DO_NOT_SET_WIRE_CLOCK */
 #ifndef U8X8_DO_NOT_SET_WIRE_CLOCK
-      Wire1.setClock(u8x8->bus_clock); 
+      /* setClock() is slow on some platforms: only call it if the clock has changed */
+      /* define U8X8_ALWAYS_SET_WIRE_CLOCK if other devices on the bus change the clock */
+#ifndef U8X8_ALWAYS_SET_WIRE_CLOCK
+      if ( u8x8_2nd_hw_i2c_clock != u8x8->bus_clock )
+#endif
+      {
+	Wire1.setClock(u8x8->bus_clock);
+	u8x8_2nd_hw_i2c_clock = u8x8->bus_clock;
+      }
 #endif
 #endif
       Wire1.beginTransmission(u8x8_GetI2CAddress(u8x8)>>1);
@@ -176,6 +176,54 @@
 #endif
 
 
+/*
+  The following macro enables tracking of modified tiles in full buffer mode.
+  The low level hvline procedures mark every tile they touch in a small bitmap 
+  (one 32 bit word per tile row, 64 bytes RAM). u8g2_SendDirty() will then only 
+  transfer the modified tiles instead of the complete buffer.
+  Not enabled by default on AVR because of the additional RAM.
+*/
+#if !defined(U8G2_WITHOUT_DIRTY_TRACKING) && !defined(__AVR__)
+#define U8G2_WITH_DIRTY_TRACKING
+#endif
+
+/*
+  The following macro enables the optional shadow buffer, see u8g2_SetShadowBuffer().
+  The shadow buffer is a copy of the display RAM: Transfers to the display compare each
+  tile against the shadow and skip the tiles which are already shown.
+  The memory for the shadow is provided by the user, u8g2_t only grows by a pointer.
+  Only supported for displays with u8g2_ll_hvline_vertical_top_lsb (SSD13xx, SH110x, ...).
+*/
+#if !defined(U8G2_WITHOUT_SHADOW_BUFFER) && !defined(__AVR__)
+#define U8G2_WITH_SHADOW_BUFFER
+#endif
+
+/*
+  The following macro enables a direct index of the glyphs 0x20..0x7f for the
+  last U8G2_GLYPH_CACHE_FONTS fonts (192 bytes RAM per font, shared by all u8g2 
+  objects). The index is built by u8g2_SetFont(), after that u8g2_font_get_glyph_data()
+  does not need to search the glyph list for ASCII characters.
+  Not enabled by default on AVR because of the additional RAM.
+*/
+#if !defined(U8G2_WITHOUT_GLYPH_CACHE) && !defined(__AVR__)
+#define U8G2_WITH_GLYPH_CACHE
+#endif
+
+/*
+  U8G2_WITH_FONT_STATS counts glyph lookups and decoded glyphs in two global
+  variables, see u8g2_font.c. Only used by the host benchmark in extras/host.
+*/
+//#define U8G2_WITH_FONT_STATS
+
+#ifndef U8G2_GLYPH_CACHE_FONTS
+#define U8G2_GLYPH_CACHE_FONTS 4
+#endif
+
+/* number of words in the dirty bitmap, larger displays mark groups of tile rows */
+#ifndef U8G2_DIRTY_MAP_ROWS
+#define U8G2_DIRTY_MAP_ROWS 16
+#endif
+
 /*==========================================*/
 
 
@@ -363,6 +411,9 @@ struct u8g2_struct
   u8g2_font_calc_vref_fnptr font_calc_vref;
   u8g2_font_decode_t font_decode;		/* new font decode structure */
   u8g2_font_info_t font_info;			/* new font info structure */
+#ifdef U8G2_WITH_GLYPH_CACHE
+  uint8_t glyph_cache_slot;		/* index of the cache entry for "font", see u8g2_font.c */
+#endif /* U8G2_WITH_GLYPH_CACHE */
 
 #ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
   /* 1 of there is an intersection between user_?? and clip_?? box */
@@ -383,6 +434,17 @@ struct u8g2_struct
 	// the following variable should be renamed to is_buffer_auto_clear
   uint8_t is_auto_page_clear; 		/* set to 0 to disable automatic clear of the buffer in firstPage() and nextPage() */
   
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  /* one bit per tile column for each tile row of the buffer, see u8g2_dirty.c */
+  uint32_t dirty_map[U8G2_DIRTY_MAP_ROWS];
+  uint32_t dirty_bytes_saved;	/* number of bytes, which were not transfered by u8g2_SendDirty() or because of the shadow buffer */
+  uint8_t dirty_col_shift;	/* bit = tile column >> dirty_col_shift */
+  uint8_t dirty_row_shift;	/* word = tile row >> dirty_row_shift */
+#endif /* U8G2_WITH_DIRTY_TRACKING */
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  uint8_t *shadow_buf_ptr;	/* copy of the display RAM with u8x8.display_info->tile_width * 8 * tile_height bytes, or NULL */
+  uint8_t is_shadow_valid;	/* 0: display RAM is unknown, the next transfer sends everything */
+#endif /* U8G2_WITH_SHADOW_BUFFER */
 };
 
 #define u8g2_GetU8x8(u8g2) ((u8x8_t *)(u8g2))
@@ -1751,6 +1813,15 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th);
 void u8g2_UpdateDisplay(u8g2_t *u8g2);
+void u8g2_DrawTileImage(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th, const uint8_t *tiles);
+void u8g2_DrawTileImagePart(u8g2_t *u8g2, u8g2_uint_t x, uint8_t ty, u8g2_uint_t w, uint8_t th, const uint8_t *tiles, uint8_t tw, u8g2_uint_t src_x);
+
+void u8g2_send_tiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t cnt, uint8_t *tile_ptr);
+#ifdef U8G2_WITH_SHADOW_BUFFER
+uint8_t u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf, uint16_t size);
+#define u8g2_GetShadowBufferSize(u8g2) ((u8g2)->u8x8.display_info->tile_width * 8 * (u8g2)->u8x8.display_info->tile_height)
+#define u8g2_InvalidateShadowBuffer(u8g2) ((u8g2)->is_shadow_valid = 0)
+#endif
 
 void u8g2_WriteBufferPBM(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM(u8g2_t *u8g2, void (*out)(const char *s));
@@ -1759,6 +1830,21 @@ void u8g2_WriteBufferPBM2(u8g2_t *u8g2, void (*out)(const char *s));
 void u8g2_WriteBufferXBM2(u8g2_t *u8g2, void (*out)(const char *s));
 
 
+/*==========================================*/
+/* u8g2_dirty.c */
+
+#ifdef U8G2_WITH_DIRTY_TRACKING
+void u8g2_SetupDirtyMap(u8g2_t *u8g2);
+void u8g2_MarkDirtyHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
+void u8g2_MarkDirtyTiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+void u8g2_SetBufferDirty(u8g2_t *u8g2);
+void u8g2_ClearBufferDirty(u8g2_t *u8g2);
+uint8_t u8g2_IsBufferDirty(u8g2_t *u8g2);
+#define u8g2_GetDirtyBytesSaved(u8g2) ((u8g2)->dirty_bytes_saved)
+#define u8g2_ResetDirtyBytesSaved(u8g2) ((u8g2)->dirty_bytes_saved = 0)
+#endif /* U8G2_WITH_DIRTY_TRACKING */
+void u8g2_SendDirty(u8g2_t *u8g2);
+
 /*==========================================*/
 /* u8g2_ll_hvline.c */
 /*
@@ -1796,6 +1882,11 @@ void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_
 void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);	/* assumes bitmap in PROGMEM */
+void u8g2_DrawCompiledBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint8_t *bitmap);	/* bitmap in PROGMEM, created by bmp2tiles.py --compiled */
+const uint8_t *u8g2_GetAtlasBitmap(const uint8_t *atlas, uint8_t index);
+void u8g2_DrawAtlasBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint8_t *atlas, uint8_t index);
+#define u8g2_GetCompiledBitmapWidth(bitmap) u8x8_pgm_read(bitmap)
+#define u8g2_GetCompiledBitmapHeight(bitmap) u8x8_pgm_read((bitmap)+1)
 
 
 /*==========================================*/
@@ -1892,6 +1983,11 @@ u8g2_uint_t u8g2_add_vector_x(u8g2_uint_t dx, int8_t x, int8_t y, uint8_t dir) U
 
 size_t u8g2_GetFontSize(const uint8_t *font_arg);
 
+#ifdef U8G2_WITH_FONT_STATS
+extern uint32_t u8g2_font_stats_decode_cnt;	/* number of decoded (drawn) glyphs */
+extern uint32_t u8g2_font_stats_lookup_cnt;	/* number of glyph searches (drawing, width calculation, ...) */
+#endif
+
 #define U8G2_FONT_HEIGHT_MODE_TEXT 0
 #define U8G2_FONT_HEIGHT_MODE_XTEXT 1
 #define U8G2_FONT_HEIGHT_MODE_ALL 2
@@ -1927,6 +2023,8 @@ uint8_t u8g2_IsAllValidUTF8(u8g2_t *u8g2, const char *str);	// checks whether al
 
 u8g2_uint_t u8g2_GetStrWidth(u8g2_t *u8g2, const char *s);
 u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str);
+u8g2_uint_t u8g2_DrawFixed(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, int32_t v, uint8_t decimals, uint8_t width);
+u8g2_uint_t u8g2_GetFixedWidth(u8g2_t *u8g2, int32_t v, uint8_t decimals, uint8_t width);
 /*u8g2_uint_t u8g2_GetExactStrWidth(u8g2_t *u8g2, const char *s);*/ /*obsolete, see also https://github.com/olikraus/u8g2/issues/1561 */
 
 
@@ -1993,6 +2091,7 @@ void u8g2_SetupBuffer_Utf8(u8g2_t *u8g2, const u8g2_cb_t *u8g2_cb);
 /* itoa procedures */
 #define u8g2_u8toa u8x8_u8toa
 #define u8g2_u16toa u8x8_u16toa
+#define u8g2_s32tofixp u8x8_s32tofixp
 
 
 /*==========================================*/
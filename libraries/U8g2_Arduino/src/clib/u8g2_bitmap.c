@@ -273,3 +273,162 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
 }
 
 
+
+/*
+  Compiled bitmaps
+  
+  Format (extras/tools/bmp2tiles.py --compiled):
+    byte 0:	width in pixel
+    byte 1:	height in pixel
+    then (height+7)/8 rows of "width" bytes: Vertical bytes with the LSB on top, 
+    which is the memory layout of the SSD13xx/SH110x full buffers. 
+  
+  In the buffer layout each byte of the bitmap is merged into (at most) two 
+  buffer bytes with a shift, there is no bit scanning as in u8g2_DrawXBMP. 
+  Draw color and bitmap mode (solid/transparent) are the same as for u8g2_DrawXBMP.
+  If the buffer has a different layout, the display is rotated or the bitmap
+  is not completly inside the clip window, the pixels are drawn one by one.
+*/
+
+/* draw the bitmap through u8g2_DrawHVLine, works for any buffer */
+static void u8g2_draw_compiled_bitmap_slow(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint8_t w, uint8_t h, const uint8_t *b)
+{
+  uint8_t color = u8g2->draw_color;
+  uint8_t ncolor = (color == 0 ? 1 : 0);
+  uint8_t i, j, bits;
+  
+  for( j = 0; j < h; j++ )
+  {
+    for( i = 0; i < w; i++ )
+    {
+      bits = u8x8_pgm_read(b + (uint16_t)(j>>3)*w + i);
+      if ( bits & (1<<(j&7)) )
+      {
+	u8g2->draw_color = color;
+	u8g2_DrawPixel(u8g2, x+i, y+j);
+      }
+      else if ( u8g2->bitmap_transparency == 0 )
+      {
+	u8g2->draw_color = ncolor;
+	u8g2_DrawPixel(u8g2, x+i, y+j);
+      }
+    }
+  }
+  u8g2->draw_color = color;
+}
+
+/* merge "bits" into a buffer byte, "mask" covers the pixels of the bitmap */
+static uint8_t u8g2_merge_compiled_byte(u8g2_t *u8g2, uint8_t d, uint8_t bits, uint8_t mask)
+{
+  if ( u8g2->draw_color == 1 )
+    d |= bits;
+  else if ( u8g2->draw_color == 0 )
+    d &= ~bits;
+  else
+    d ^= bits;
+  
+  if ( u8g2->bitmap_transparency == 0 )
+  {
+    /* pixels which are not set get the opposite color */
+    mask &= ~bits;
+    if ( u8g2->draw_color == 0 )
+      d |= mask;
+    else
+      d &= ~mask;
+  }
+  return d;
+}
+
+void u8g2_DrawCompiledBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint8_t *bitmap)
+{
+  uint8_t w = u8x8_pgm_read(bitmap);
+  uint8_t h = u8x8_pgm_read(bitmap+1);
+  uint8_t rows = (h+7)>>3;
+  uint8_t shift = y & 7;
+  uint8_t row_begin = u8g2->tile_curr_row;
+  uint8_t row_end = row_begin + u8g2->tile_buf_height;
+  uint8_t r, i, ty, bits, mask;
+  uint8_t *ptr;
+  
+  bitmap += 2;
+  if ( w == 0 || h == 0 )
+    return;
+#ifdef U8G2_WITH_INTERSECTION
+  if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
+    return;
+#endif /* U8G2_WITH_INTERSECTION */
+
+  if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb || u8g2->cb != U8G2_R0 
+      || (uint16_t)x + w > u8g2->width || (uint16_t)y + h > u8g2->height
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+      || x < u8g2->clip_x0 || (uint16_t)x + w > u8g2->clip_x1 || y < u8g2->clip_y0 || (uint16_t)y + h > u8g2->clip_y1
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+    )
+  {
+    u8g2_draw_compiled_bitmap_slow(u8g2, x, y, w, h, bitmap);
+    return;
+  }
+  
+  for( r = 0; r < rows; r++ )
+  {
+    /* pixels of this bitmap row, the last row may be partial */
+    mask = h - r*8 >= 8 ? 0x0ff : (1 << (h - r*8)) - 1;
+    
+    /* upper part, buffer row ty */
+    ty = (y >> 3) + r;
+    if ( ty >= row_begin && ty < row_end )
+    {
+      ptr = u8g2->tile_buf_ptr + (uint16_t)(ty - row_begin) * u8g2->pixel_buf_width + x;
+      for( i = 0; i < w; i++ )
+      {
+	bits = u8x8_pgm_read(bitmap + i);
+	ptr[i] = u8g2_merge_compiled_byte(u8g2, ptr[i], bits << shift, mask << shift);
+      }
+#ifdef U8G2_WITH_DIRTY_TRACKING
+      u8g2_MarkDirtyTiles(u8g2, x >> 3, ty - row_begin, ((x + w - 1) >> 3) - (x >> 3) + 1, 1);
+#endif
+    }
+    
+    /* lower part, buffer row ty+1, only if the bitmap row is not aligned to the buffer */
+    ty++;
+    if ( shift != 0 && (uint8_t)(mask >> (8 - shift)) != 0 && ty >= row_begin && ty < row_end )
+    {
+      ptr = u8g2->tile_buf_ptr + (uint16_t)(ty - row_begin) * u8g2->pixel_buf_width + x;
+      for( i = 0; i < w; i++ )
+      {
+	bits = u8x8_pgm_read(bitmap + i);
+	ptr[i] = u8g2_merge_compiled_byte(u8g2, ptr[i], bits >> (8 - shift), mask >> (8 - shift));
+      }
+#ifdef U8G2_WITH_DIRTY_TRACKING
+      u8g2_MarkDirtyTiles(u8g2, x >> 3, ty - row_begin, ((x + w - 1) >> 3) - (x >> 3) + 1, 1);
+#endif
+    }
+    bitmap += w;
+  }
+}
+
+/*
+  Atlas: several compiled bitmaps in one PROGMEM array (extras/tools/bmp2tiles.py --atlas)
+    byte 0:	number of bitmaps
+    then one 16 bit offset (low byte first) per bitmap, counted from the start of the atlas
+    then the compiled bitmaps. Identical bitmaps share their data.
+  Returns NULL if index is out of range.
+*/
+const uint8_t *u8g2_GetAtlasBitmap(const uint8_t *atlas, uint8_t index)
+{
+  uint16_t offset;
+  if ( index >= u8x8_pgm_read(atlas) )
+    return NULL;
+  atlas++;
+  offset = u8x8_pgm_read(atlas + 2*index + 1);
+  offset <<= 8;
+  offset |= u8x8_pgm_read(atlas + 2*index);
+  return atlas - 1 + offset;
+}
+
+void u8g2_DrawAtlasBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const uint8_t *atlas, uint8_t index)
+{
+  const uint8_t *bitmap = u8g2_GetAtlasBitmap(atlas, index);
+  if ( bitmap != NULL )
+    u8g2_DrawCompiledBitmap(u8g2, x, y, bitmap);
+}
@@ -44,10 +44,98 @@ void u8g2_ClearBuffer(u8g2_t *u8g2)
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
   memset(u8g2->tile_buf_ptr, 0, cnt);
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_SetBufferDirty(u8g2);
+#endif
 }
 
 /*============================================*/
 
+#ifdef U8G2_WITH_SHADOW_BUFFER
+
+/*
+  Description:
+    Assign a shadow buffer, a copy of the display RAM. Each transfer to the 
+    display (u8g2_SendBuffer, u8g2_NextPage, u8g2_UpdateDisplayArea, 
+    u8g2_SendDirty) compares the tiles against the shadow and only sends the
+    tiles which have changed since the last transfer.
+    "buf" needs u8g2_GetShadowBufferSize() bytes (the size of the complete display, 
+    also in page mode). Use NULL to disable the shadow buffer.
+    The display content is unknown after this call, so the next complete 
+    transfer will send all tiles.
+    
+  Limitations:
+    - Only for displays with u8g2_ll_hvline_vertical_top_lsb, ignored for other displays
+    - Any direct u8x8 output to the display must be followed by u8g2_InvalidateShadowBuffer()
+    
+  Returns:
+    0 if "buf" is too small (the shadow buffer is not changed), 1 otherwise
+*/
+uint8_t u8g2_SetShadowBuffer(u8g2_t *u8g2, uint8_t *buf, uint16_t size)
+{
+  if ( buf != NULL && size < (uint16_t)u8g2_GetShadowBufferSize(u8g2) )
+    return 0;
+  u8g2->shadow_buf_ptr = buf;
+  u8g2->is_shadow_valid = 0;
+  return 1;
+}
+
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+
+/*
+  Send "cnt" tiles, starting at tile position tx/ty of the display. Same as 
+  u8x8_DrawTile(), but with a shadow buffer, only the tiles which differ from
+  the shadow are sent (in contiguous runs, bridging single unchanged tiles).
+*/
+void u8g2_send_tiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t cnt, uint8_t *tile_ptr)
+{
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  uint8_t *shadow;
+  uint8_t i, start;
+  
+  if ( u8g2->shadow_buf_ptr != NULL && u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+  {
+    shadow = u8g2->shadow_buf_ptr;
+    shadow += (uint16_t)ty * (uint16_t)(u8g2_GetU8x8(u8g2)->display_info->tile_width*8);
+    shadow += tx*8;
+    
+    if ( u8g2->is_shadow_valid == 0 )
+    {
+      memcpy(shadow, tile_ptr, cnt*8);
+      u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx, ty, cnt, tile_ptr);
+      return;
+    }
+    
+    i = 0;
+    while( i < cnt )
+    {
+      if ( memcmp(tile_ptr + i*8, shadow + i*8, 8) == 0 )
+      {
+#ifdef U8G2_WITH_DIRTY_TRACKING
+	u8g2->dirty_bytes_saved += 8;
+#endif
+	i++;
+	continue;
+      }
+      start = i;
+      while( i < cnt )
+      {
+	if ( memcmp(tile_ptr + i*8, shadow + i*8, 8) == 0 )
+	{
+	  if ( i+1 >= cnt || memcmp(tile_ptr + (i+1)*8, shadow + (i+1)*8, 8) == 0 )
+	    break;
+	}
+	i++;
+      }
+      memcpy(shadow + start*8, tile_ptr + start*8, (i-start)*8);
+      u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx+start, ty, i-start, tile_ptr + start*8);
+    }
+    return;
+  }
+#endif /* U8G2_WITH_SHADOW_BUFFER */
+  u8x8_DrawTile(u8g2_GetU8x8(u8g2), tx, ty, cnt, tile_ptr);
+}
+
 static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_tile_row)
 {
   uint8_t *ptr;
@@ -60,7 +148,7 @@ static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_
   offset *= w;
   offset *= 8;
   ptr += offset;
-  u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
+  u8g2_send_tiles(u8g2, 0, dest_tile_row, w, ptr);
 }
 
 /* 
@@ -81,12 +169,46 @@ static void u8g2_send_buffer(u8g2_t *u8g2)
   dest_row = u8g2->tile_curr_row;
   dest_max = u8g2_GetU8x8(u8g2)->display_info->tile_height;
   
+  /* 
+    full buffer: try to send everything as one data stream (U8X8_MSG_DISPLAY_DRAW_FRAME).
+    With a valid shadow buffer, the tile compare below usually sends much less.
+  */
+  if ( dest_row == 0 && src_max >= dest_max 
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    && ( u8g2->shadow_buf_ptr == NULL || u8g2->is_shadow_valid == 0 )
+#endif
+    )
+  {
+    if ( u8x8_DrawFrame(u8g2_GetU8x8(u8g2), u8g2->tile_buf_ptr) != 0 )
+    {
+#ifdef U8G2_WITH_SHADOW_BUFFER
+      if ( u8g2->shadow_buf_ptr != NULL && u8g2->ll_hvline == u8g2_ll_hvline_vertical_top_lsb )
+      {
+	memcpy(u8g2->shadow_buf_ptr, u8g2->tile_buf_ptr, u8g2_GetShadowBufferSize(u8g2));
+	u8g2->is_shadow_valid = 1;
+      }
+#endif
+#ifdef U8G2_WITH_DIRTY_TRACKING
+      u8g2_ClearBufferDirty(u8g2);
+#endif
+      return;
+    }
+  }
+  
   do
   {
     u8g2_send_tile_row(u8g2, src_row, dest_row);
     src_row++;
     dest_row++;
   } while( src_row < src_max && dest_row < dest_max );
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  /* all tile rows have been sent (last page in page mode), the shadow is complete now */
+  if ( dest_row >= dest_max )
+    u8g2->is_shadow_valid = 1;
+#endif
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_ClearBufferDirty(u8g2);
+#endif
 }
 
 /* same as u8g2_send_buffer but also send the DISPLAY_REFRESH message (used by SSD1606) */
@@ -167,13 +289,172 @@ void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, u
   
   while( th > 0 )
   {
-    u8x8_DrawTile( u8g2_GetU8x8(u8g2), tx, ty, tw, ptr );
+    u8g2_send_tiles( u8g2, tx, ty, tw, ptr );
     ptr += page_size;
     ty++;
     th--;
   }  
 }
 
+/*============================================*/
+
+/*
+  Copy "cnt" bytes from (possibly) flash memory into the buffer.
+  AVR needs the LPM instruction, the ESP8266 flash only allows aligned 32 bit reads.
+*/
+#if defined(__GNUC__) && defined(__AVR__)
+#define u8g2_copy_pgm(dest, src, cnt) memcpy_P((dest), (src), (cnt))
+#elif defined(ESP8266)
+static void u8g2_copy_pgm(uint8_t *dest, const uint8_t *src, uint16_t cnt)
+{
+  uint32_t word;
+  while( cnt > 0 && ((uint32_t)src & 3) != 0 )
+  {
+    *dest++ = u8x8_pgm_read(src);
+    src++;
+    cnt--;
+  }
+  while( cnt >= 4 )
+  {
+    word = *(const uint32_t *)src;
+    memcpy(dest, &word, 4);
+    dest += 4;
+    src += 4;
+    cnt -= 4;
+  }
+  while( cnt > 0 )
+  {
+    *dest++ = u8x8_pgm_read(src);
+    src++;
+    cnt--;
+  }
+}
+#else
+#define u8g2_copy_pgm(dest, src, cnt) memcpy((dest), (src), (cnt))
+#endif
+
+/*
+  Description:
+    Copy a pre-converted image into the buffer. The image must already be in the 
+    memory layout of the buffer: Vertical bytes with the LSB on top, tw*8 bytes 
+    per tile row, tile rows from top to bottom (extras/tools/bmp2tiles.py 
+    creates this format). This replaces the content of the covered tiles, 
+    so there is no need to clear the buffer before.
+    Compared to u8g2_DrawXBMP, this is one memcpy per tile row instead
+    of one line draw per pixel run.
+    The image may be located in PROGMEM.
+
+  Limitations:
+    - Tile positions and sizes (pixel position divided by 8)
+    - Any display rotation/mirror and the draw color are ignored
+    - Only for displays with u8g2_ll_hvline_vertical_top_lsb (SSD13xx, SH110x, ...), 
+      does nothing for other buffer layouts
+    - Works in page mode: Only the tile rows of the current page are copied
+*/
+void u8g2_DrawTileImage(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th, const uint8_t *tiles)
+{
+  uint8_t *ptr;
+  uint16_t src_stride;
+  uint8_t tile_width;
+  uint8_t row_end;
+  uint8_t cnt;
+  
+  if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    return;
+  
+  tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  if ( tx >= tile_width )
+    return;
+  
+  src_stride = tw;
+  src_stride *= 8;
+  cnt = tw;
+  if ( cnt > tile_width - tx )
+    cnt = tile_width - tx;
+  
+  /* skip the image rows above the current page */
+  while( th > 0 && ty < u8g2->tile_curr_row )
+  {
+    tiles += src_stride;
+    ty++;
+    th--;
+  }
+  
+  row_end = u8g2->tile_curr_row + u8g2->tile_buf_height;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += (uint16_t)(ty - u8g2->tile_curr_row) * u8g2->pixel_buf_width;
+  ptr += tx*8;
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  if ( ty < row_end )
+    u8g2_MarkDirtyTiles(u8g2, tx, ty - u8g2->tile_curr_row, cnt, th < row_end - ty ? th : row_end - ty);
+#endif
+  while( th > 0 && ty < row_end )
+  {
+    u8g2_copy_pgm(ptr, tiles, cnt*8);
+    ptr += u8g2->pixel_buf_width;
+    tiles += src_stride;
+    ty++;
+    th--;
+  }
+}
+
+/*
+  Description:
+    Like u8g2_DrawTileImage, but copies the pixel columns src_x ... src_x+w-1 of
+    an image which is tw tiles wide to the pixel column x of the buffer.
+    The horizontal position is not limited to tiles, so two images can be
+    combined into a horizontal slide:
+      u8g2_DrawTileImagePart(u8g2, 0, 0, 128-p, 8, from, 16, p);
+      u8g2_DrawTileImagePart(u8g2, 128-p, 0, p, 8, to, 16, 0);
+
+  Limitations: Same as u8g2_DrawTileImage, ty and th are still tile rows.
+*/
+void u8g2_DrawTileImagePart(u8g2_t *u8g2, u8g2_uint_t x, uint8_t ty, u8g2_uint_t w, uint8_t th, const uint8_t *tiles, uint8_t tw, u8g2_uint_t src_x)
+{
+  uint8_t *ptr;
+  uint16_t src_stride;
+  uint16_t buf_width;
+  uint8_t row_end;
+
+  if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    return;
+
+  buf_width = u8g2->pixel_buf_width;
+  if ( x >= buf_width || w == 0 )
+    return;
+  if ( (uint16_t)x + w > buf_width )
+    w = buf_width - x;
+
+  src_stride = tw;
+  src_stride *= 8;
+  tiles += src_x;
+
+  /* skip the image rows above the current page */
+  while( th > 0 && ty < u8g2->tile_curr_row )
+  {
+    tiles += src_stride;
+    ty++;
+    th--;
+  }
+
+  row_end = u8g2->tile_curr_row + u8g2->tile_buf_height;
+  ptr = u8g2->tile_buf_ptr;
+  ptr += (uint16_t)(ty - u8g2->tile_curr_row) * buf_width;
+  ptr += x;
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  if ( ty < row_end )
+    u8g2_MarkDirtyTiles(u8g2, x >> 3, ty - u8g2->tile_curr_row, (((uint16_t)x + w - 1) >> 3) - (x >> 3) + 1, th < row_end - ty ? th : row_end - ty);
+#endif
+  while( th > 0 && ty < row_end )
+  {
+    u8g2_copy_pgm(ptr, tiles, w);
+    ptr += buf_width;
+    tiles += src_stride;
+    ty++;
+    th--;
+  }
+}
+
 /* same as sendBuffer, but does not send the ePaper refresh message */
 void u8g2_UpdateDisplay(u8g2_t *u8g2)
 {
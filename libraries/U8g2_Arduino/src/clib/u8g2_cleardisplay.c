@@ -38,6 +38,10 @@
 /* This is done with u8g2 picture loop, because we can not use the u8x8 function in all cases */
 void u8g2_ClearDisplay(u8g2_t *u8g2)
 {
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  /* usually called after the display init, RAM content is unknown */
+  u8g2_InvalidateShadowBuffer(u8g2);
+#endif
   u8g2_FirstPage(u8g2);
   do {
   } while ( u8g2_NextPage(u8g2) );
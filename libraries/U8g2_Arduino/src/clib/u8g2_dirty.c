@@ -0,0 +1,250 @@
+/*
+
+  u8g2_dirty.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2016, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification, 
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list 
+    of conditions and the following disclaimer.
+    
+  * Redistributions in binary form must reproduce the above copyright notice, this 
+    list of conditions and the following disclaimer in the documentation and/or other 
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND 
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, 
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF 
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE 
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, 
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT 
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; 
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER 
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) 
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.  
+
+  Dirty tile tracking for full buffer mode
+
+  Each word of dirty_map belongs to one tile row of the buffer, each bit of 
+  a word to one tile column. Displays with more than 32 tile columns or 
+  U8G2_DIRTY_MAP_ROWS tile rows will mark groups of tiles (dirty_col_shift and
+  dirty_row_shift), so the map is never larger than U8G2_DIRTY_MAP_ROWS words.
+  
+  The ll_hvline procedures mark the tiles they touch, u8g2_ClearBuffer()
+  marks everything. Any transfer of the complete buffer clears the map.
+  Direct writes to the buffer (u8g2_GetBufferPtr) must be reported with 
+  u8g2_MarkDirtyTiles() or u8g2_SetBufferDirty().
+
+*/
+
+#include "u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_DIRTY_TRACKING
+
+/* bit mask with the bits c0..c1 (including c1) set, c1 must be less than 32 */
+static uint32_t u8g2_dirty_mask(uint8_t c0, uint8_t c1)
+{
+  return (((uint32_t)2) << c1) - (((uint32_t)1) << c0);
+}
+
+void u8g2_SetupDirtyMap(u8g2_t *u8g2)
+{
+  uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  
+  u8g2->dirty_col_shift = 0;
+  while( ((tile_width-1) >> u8g2->dirty_col_shift) >= 32 )
+    u8g2->dirty_col_shift++;
+  u8g2->dirty_row_shift = 0;
+  while( ((u8g2->tile_buf_height-1) >> u8g2->dirty_row_shift) >= U8G2_DIRTY_MAP_ROWS )
+    u8g2->dirty_row_shift++;
+  
+  /* content of the display is unknown */
+  u8g2_SetBufferDirty(u8g2);
+  u8g2->dirty_bytes_saved = 0;
+}
+
+/*
+  x,y		Upper left position of the line within the local buffer (not the display!)
+  len		length of the line in pixel, len must not be 0
+  dir		0: horizontal line (left to right)
+		1: vertical line (top to bottom)
+*/
+void u8g2_MarkDirtyHVLine(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  u8g2_uint_t c0, c1, r0, r1;
+  uint32_t mask;
+  
+  len--;
+  c0 = x >> 3;
+  c1 = c0;
+  r0 = y >> 3;
+  r1 = r0;
+  if ( dir == 0 )
+    c1 = (x+len) >> 3;
+  else
+    r1 = (y+len) >> 3;
+  
+  mask = u8g2_dirty_mask(c0 >> u8g2->dirty_col_shift, c1 >> u8g2->dirty_col_shift);
+  r0 >>= u8g2->dirty_row_shift;
+  r1 >>= u8g2->dirty_row_shift;
+  do
+  {
+    u8g2->dirty_map[r0] |= mask;
+    r0++;
+  } while( r0 <= r1 );
+}
+
+/*
+  tx, ty, tw, th: tile position and size within the local buffer
+*/
+void u8g2_MarkDirtyTiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+  uint16_t c1, r1;
+  uint32_t mask;
+  
+  if ( tw == 0 || th == 0 )
+    return;
+  
+  c1 = tx;
+  c1 += tw-1;
+  r1 = ty;
+  r1 += th-1;
+  
+  tx >>= u8g2->dirty_col_shift;
+  c1 >>= u8g2->dirty_col_shift;
+  if ( c1 > 31 )
+    c1 = 31;
+  if ( tx > c1 )
+    return;
+  
+  ty >>= u8g2->dirty_row_shift;
+  r1 >>= u8g2->dirty_row_shift;
+  if ( r1 >= U8G2_DIRTY_MAP_ROWS )
+    r1 = U8G2_DIRTY_MAP_ROWS-1;
+  
+  mask = u8g2_dirty_mask(tx, c1);
+  while( ty <= r1 )
+  {
+    u8g2->dirty_map[ty] |= mask;
+    ty++;
+  }
+}
+
+void u8g2_SetBufferDirty(u8g2_t *u8g2)
+{
+  memset(u8g2->dirty_map, 0xff, sizeof(u8g2->dirty_map));
+}
+
+void u8g2_ClearBufferDirty(u8g2_t *u8g2)
+{
+  memset(u8g2->dirty_map, 0, sizeof(u8g2->dirty_map));
+}
+
+uint8_t u8g2_IsBufferDirty(u8g2_t *u8g2)
+{
+  uint8_t i;
+  for( i = 0; i < U8G2_DIRTY_MAP_ROWS; i++ )
+    if ( u8g2->dirty_map[i] != 0 )
+      return 1;
+  return 0;
+}
+
+#define u8g2_is_tile_dirty(u8g2, bits, tx) (((bits) >> ((tx) >> (u8g2)->dirty_col_shift)) & 1)
+
+#endif /* U8G2_WITH_DIRTY_TRACKING */
+
+/*
+  Description:
+    Same as u8g2_SendBuffer(), but only transfer the tiles which have been 
+    modified since the last transfer.
+    Contiguous dirty tiles of a tile row are sent with one u8x8_DrawTile() call.
+    With a shadow buffer (u8g2_SetShadowBuffer), dirty tiles which did not 
+    change their content are skipped as well.
+    A single clean tile between two dirty runs is sent as well: This is cheaper
+    than the address setup for another run.
+    Displays with a horizontal buffer layout (ST7920, ...) can only transfer 
+    complete tile rows, so any dirty tile will send the complete tile row.
+    The number of bytes which did not need to be sent is accumulated in
+    u8g2_GetDirtyBytesSaved().
+
+  Limitations:
+    - Only useful in full buffer mode, page mode will send the complete buffer
+    - Without U8G2_WITH_DIRTY_TRACKING this is the same as u8g2_SendBuffer()
+*/
+void u8g2_SendDirty(u8g2_t *u8g2)
+{
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8x8_t *u8x8 = u8g2_GetU8x8(u8g2);
+  uint8_t tile_width = u8x8->display_info->tile_width;
+  uint8_t tile_height = u8x8->display_info->tile_height;
+  uint8_t *row_ptr;
+  uint32_t bits;
+  uint8_t tx, ty, start;
+  
+  /* check, whether we are in full buffer mode */
+  /* without a valid shadow, the complete buffer must be sent once */
+  if ( u8g2->tile_buf_height != tile_height 
+#ifdef U8G2_WITH_SHADOW_BUFFER
+    || ( u8g2->shadow_buf_ptr != NULL && u8g2->is_shadow_valid == 0 )
+#endif
+    )
+  {
+    u8g2_SendBuffer(u8g2);
+    return;
+  }
+  
+  row_ptr = u8g2->tile_buf_ptr;
+  for( ty = 0; ty < tile_height; ty++ )
+  {
+    bits = u8g2->dirty_map[ty >> u8g2->dirty_row_shift];
+    if ( bits == 0 )
+    {
+      u8g2->dirty_bytes_saved += (uint16_t)tile_width*8;
+    }
+    else if ( u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    {
+      u8x8_DrawTile(u8x8, 0, ty, tile_width, row_ptr);
+    }
+    else
+    {
+      tx = 0;
+      while( tx < tile_width )
+      {
+        if ( u8g2_is_tile_dirty(u8g2, bits, tx) == 0 )
+        {
+          u8g2->dirty_bytes_saved += 8;
+          tx++;
+          continue;
+        }
+        start = tx;
+        while( tx < tile_width )
+        {
+          if ( u8g2_is_tile_dirty(u8g2, bits, tx) == 0 )
+          {
+            /* bridge a gap of one tile */
+            if ( tx+1 >= tile_width || u8g2_is_tile_dirty(u8g2, bits, tx+1) == 0 )
+              break;
+          }
+          tx++;
+        }
+        u8g2_send_tiles(u8g2, start, ty, tx-start, row_ptr + start*8);
+      }
+    }
+    row_ptr += u8g2->pixel_buf_width;
+  }
+  
+  u8g2_ClearBufferDirty(u8g2);
+  u8x8_RefreshDisplay(u8x8);
+#else
+  u8g2_SendBuffer(u8g2);
+#endif /* U8G2_WITH_DIRTY_TRACKING */
+}
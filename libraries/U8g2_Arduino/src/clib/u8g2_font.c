@@ -39,6 +39,28 @@
 /* this is the size for the new font format */
 #define U8G2_FONT_DATA_STRUCT_SIZE 23
 
+#ifdef U8G2_WITH_FONT_STATS
+uint32_t u8g2_font_stats_decode_cnt = 0;
+uint32_t u8g2_font_stats_lookup_cnt = 0;
+#endif
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+#include <string.h>
+
+/* direct index of the glyphs U8G2_GLYPH_CACHE_FIRST..U8G2_GLYPH_CACHE_FIRST+U8G2_GLYPH_CACHE_CNT-1 */
+#define U8G2_GLYPH_CACHE_FIRST 0x20
+#define U8G2_GLYPH_CACHE_CNT 96
+
+typedef struct
+{
+  const uint8_t *font;				/* NULL: unused entry */
+  uint16_t offset[U8G2_GLYPH_CACHE_CNT];	/* glyph data relative to the font start, 0: glyph not in font */
+  uint8_t end;				/* encodings below "end" are indexed, the glyph list has the rest */
+} u8g2_glyph_cache_t;
+
+static u8g2_glyph_cache_t u8g2_glyph_cache[U8G2_GLYPH_CACHE_FONTS];
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 /*
   font data:
 
@@ -616,6 +638,9 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
   int8_t d;
   int8_t h;
   u8g2_font_decode_t *decode = &(u8g2->font_decode);
+#ifdef U8G2_WITH_FONT_STATS
+  u8g2_font_stats_decode_cnt++;
+#endif
     
   u8g2_font_setup_decode(u8g2, glyph_data);     /* set values in u8g2->font_decode data structure */
   h = u8g2->font_decode.glyph_height;
@@ -717,6 +742,9 @@ int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
   int8_t d;
   int8_t h;
   u8g2_font_decode_t *decode = &(u8g2->font_decode);
+#ifdef U8G2_WITH_FONT_STATS
+  u8g2_font_stats_decode_cnt++;
+#endif
     
   u8g2_font_setup_decode(u8g2, glyph_data);     /* set values in u8g2->font_decode data structure */
   h = u8g2->font_decode.glyph_height;
@@ -782,6 +810,26 @@ int8_t u8g2_font_2x_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 {
   const uint8_t *font = u8g2->font;
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_glyph_cache_t *cache;
+#endif
+  
+#ifdef U8G2_WITH_FONT_STATS
+  u8g2_font_stats_lookup_cnt++;
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+  if ( encoding >= U8G2_GLYPH_CACHE_FIRST && encoding < U8G2_GLYPH_CACHE_FIRST+U8G2_GLYPH_CACHE_CNT )
+  {
+    cache = u8g2_glyph_cache + u8g2->glyph_cache_slot;
+    /* the entry might have been reused for the font of another u8g2 object */
+    if ( cache->font == font && encoding < cache->end )
+    {
+      if ( cache->offset[encoding-U8G2_GLYPH_CACHE_FIRST] == 0 )
+	return NULL;
+      return font + cache->offset[encoding-U8G2_GLYPH_CACHE_FIRST];
+    }
+  }
+#endif /* U8G2_WITH_GLYPH_CACHE */
   font += U8G2_FONT_DATA_STRUCT_SIZE;
 
   
@@ -1276,6 +1324,56 @@ void u8g2_SetFontPosCenter(u8g2_t *u8g2)
 
 /*===============================================*/
 
+#ifdef U8G2_WITH_GLYPH_CACHE
+/*
+  Return the cache entry for "font", the entry is created if required.
+  The least recently created entry is replaced.
+*/
+static uint8_t u8g2_glyph_cache_get_slot(const uint8_t *font)
+{
+  static uint8_t next_slot = 0;
+  u8g2_glyph_cache_t *cache;
+  const uint8_t *glyph;
+  uint8_t i, encoding;
+  uint32_t offset;
+  
+  for( i = 0; i < U8G2_GLYPH_CACHE_FONTS; i++ )
+    if ( u8g2_glyph_cache[i].font == font )
+      return i;
+  
+  i = next_slot;
+  next_slot++;
+  if ( next_slot >= U8G2_GLYPH_CACHE_FONTS )
+    next_slot = 0;
+  
+  cache = u8g2_glyph_cache + i;
+  memset(cache->offset, 0, sizeof(cache->offset));
+  cache->end = U8G2_GLYPH_CACHE_FIRST+U8G2_GLYPH_CACHE_CNT;
+  
+  /* the glyphs are sorted by encoding, the list ends with a glyph size of 0 */
+  glyph = font + U8G2_FONT_DATA_STRUCT_SIZE;
+  while( u8x8_pgm_read( glyph + 1 ) != 0 )
+  {
+    encoding = u8x8_pgm_read( glyph );
+    if ( encoding >= U8G2_GLYPH_CACHE_FIRST+U8G2_GLYPH_CACHE_CNT )
+      break;
+    if ( encoding >= U8G2_GLYPH_CACHE_FIRST )
+    {
+      offset = (uint32_t)(glyph - font) + 2;	/* skip encoding and glyph size */
+      if ( offset > 0x0ffff )
+      {
+	cache->end = encoding;	/* not reachable with 16 bit, use the glyph list for the rest */
+	break;
+      }
+      cache->offset[encoding-U8G2_GLYPH_CACHE_FIRST] = (uint16_t)offset;
+    }
+    glyph += u8x8_pgm_read( glyph + 1 );
+  }
+  cache->font = font;
+  return i;
+}
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 {
   if ( u8g2->font != font )
@@ -1286,6 +1384,9 @@ void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 //#endif 
     u8g2->font = font;
     u8g2_read_font_info(&(u8g2->font_info), font);
+#ifdef U8G2_WITH_GLYPH_CACHE
+    u8g2->glyph_cache_slot = u8g2_glyph_cache_get_slot(font);
+#endif
     u8g2_UpdateRefHeight(u8g2);
     /* u8g2_SetFontPosBaseline(u8g2); */ /* removed with issue 195 */
   }
@@ -1551,6 +1652,25 @@ u8g2_uint_t u8g2_GetUTF8Width(u8g2_t *u8g2, const char *str)
   return u8g2_string_width(u8g2, str);
 }
 
+/*
+  Draw a fixed point number, see u8x8_s32tofixp() for v, decimals and width.
+  The digits are formatted on the stack, there is no printf and no float involved:
+  u8g2_DrawFixed(u8g2, x, y, 84, 1, 0) draws "8.4"
+*/
+u8g2_uint_t u8g2_DrawFixed(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, int32_t v, uint8_t decimals, uint8_t width)
+{
+  char buf[U8X8_FIXED_BUF_LEN];
+  u8x8_s32tofixp(buf, v, decimals, width, ' ');
+  return u8g2_DrawStr(u8g2, x, y, buf);
+}
+
+u8g2_uint_t u8g2_GetFixedWidth(u8g2_t *u8g2, int32_t v, uint8_t decimals, uint8_t width)
+{
+  char buf[U8X8_FIXED_BUF_LEN];
+  u8x8_s32tofixp(buf, v, decimals, width, ' ');
+  return u8g2_GetStrWidth(u8g2, buf);
+}
+
 
 
 void u8g2_SetFontDirection(u8g2_t *u8g2, uint8_t dir)
@@ -84,6 +84,10 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   //assert(y >= u8g2->buf_y0);
   //assert(y < u8g2_GetU8x8(u8g2)->display_info->tile_height*8);
   
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_MarkDirtyHVLine(u8g2, x, y, len, dir);
+#endif
+
   /* bytes are vertical, lsb on top (y=0), msb at bottom (y=7) */
   bit_pos = y;		/* overflow truncate is ok here... */
   bit_pos &= 7; 	/* ... because only the lowest 3 bits are needed */
@@ -200,6 +204,9 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
 */
 void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_MarkDirtyHVLine(u8g2, x, y, len, dir);
+#endif
   if ( dir == 0 )
   {
     do
@@ -249,6 +256,10 @@ void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_
   uint8_t mask;
   uint8_t tile_width = u8g2_GetU8x8(u8g2)->display_info->tile_width;
 
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_MarkDirtyHVLine(u8g2, x, y, len, dir);
+#endif
+
   bit_pos = x;		/* overflow truncate is ok here... */
   bit_pos &= 7; 	/* ... because only the lowest 3 bits are needed */
   mask = 128;
@@ -348,6 +359,9 @@ static void u8g2_draw_pixel_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8
 /* SH1122, LD7032, ST7920, ST7986, LC7981, T6963, SED1330, RA8835, MAX7219, LS0 */ 
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_MarkDirtyHVLine(u8g2, x, y, len, dir);
+#endif
   if ( dir == 0 )
   {
     do
@@ -71,6 +71,9 @@ void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0,
 void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb, const u8g2_cb_t *u8g2_cb)
 {
   u8g2->font = NULL;
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2->glyph_cache_slot = 0;
+#endif
   //u8g2->kerning = NULL;
   //u8g2->get_kerning_cb = u8g2_GetNullKerning;
   
@@ -89,6 +92,14 @@ void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_
   u8g2->draw_color = 1;
   u8g2->is_auto_page_clear = 1;
   
+#ifdef U8G2_WITH_DIRTY_TRACKING
+  u8g2_SetupDirtyMap(u8g2);
+#endif
+#ifdef U8G2_WITH_SHADOW_BUFFER
+  u8g2->shadow_buf_ptr = NULL;
+  u8g2->is_shadow_valid = 0;
+#endif
+  
   u8g2->cb = u8g2_cb;
   u8g2->cb->update_dimension(u8g2);
 #ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
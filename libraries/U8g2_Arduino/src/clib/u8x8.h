@@ -96,6 +96,22 @@
 /* Define this for an additional user pointer inside the u8x8 data struct */
 //#define U8X8_WITH_USER_PTR
 
+/*
+  Max. number of data bytes in one I2C transfer of the SSD13xx CAD procedures.
+  The data is preceded by the 0x40 control byte, so U8X8_I2C_DATA_CHUNK+1 bytes
+  must fit into the transmit buffer of the Wire library:
+  AVR Wire has 32 bytes, the historic limit of 24 bytes is kept for all platforms
+  except ESP8266 and ESP32, where the Wire buffer has 128 bytes.
+  U8x8lib.cpp checks this value against the Wire buffer size, if Wire exports it.
+*/
+#ifndef U8X8_I2C_DATA_CHUNK
+#if defined(ESP8266) || defined(ARDUINO_ARCH_ESP8266) || defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+#define U8X8_I2C_DATA_CHUNK 127
+#else
+#define U8X8_I2C_DATA_CHUNK 24
+#endif
+#endif
+
 
 /* Undefine this to remove u8x8_SetFlipMode function */
 /* 26 May 2016: Obsolete */
@@ -211,6 +227,7 @@ uint8_t u8x8_pgm_read_esp(const uint8_t * addr);   /* u8x8_8x8.c */
 typedef struct u8x8_struct u8x8_t;
 typedef struct u8x8_display_info_struct u8x8_display_info_t;
 typedef struct u8x8_tile_struct u8x8_tile_t;
+typedef struct u8x8_frame_struct u8x8_frame_t;
 
 typedef uint8_t (*u8x8_msg_cb)(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 typedef uint16_t (*u8x8_char_cb)(u8x8_t *u8x8, uint8_t b);
@@ -233,6 +250,12 @@ struct u8x8_tile_struct
   uint8_t y_pos;	/* tile y position */
 };
 
+struct u8x8_frame_struct
+{
+  uint8_t *buf_ptr;	/* tile_width*tile_height tiles, tile rows one after the other */
+  uint8_t is_done;	/* set to 1 by the display procedure, if the frame has been sent */
+};
+
 
 struct u8x8_display_info_struct
 {
@@ -533,6 +556,23 @@ void u8x8_d_helper_display_init(u8x8_t *u8g2);
 */
 #define U8X8_MSG_DISPLAY_REFRESH 16
 
+/*
+  Name: 	U8X8_MSG_DISPLAY_DRAW_FRAME
+  Args:	
+    arg_int: -
+    arg_ptr: pointer to u8x8_frame_t
+        uint8_t *buf_ptr;	tile_width*tile_height tiles, same layout as the u8g2 full buffer
+	uint8_t is_done;	must be set to 1 by the display procedure
+  Tasks:
+    Send the complete display content as one data stream, without the addressing
+    commands for each tile row (for example with the horizontal addressing mode 
+    of the SSD1306). This message is optional: If "is_done" is still 0 after the 
+    call, the display does not support it and the caller must use DRAW_TILE.
+  Use
+    uint8_t u8x8_DrawFrame(u8x8_t *u8x8, uint8_t *buf)
+*/
+#define U8X8_MSG_DISPLAY_DRAW_FRAME 17
+
 /*==========================================*/
 /* u8x8_setup.c */
 
@@ -551,6 +591,7 @@ void u8x8_Setup(u8x8_t *u8x8, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_m
 /*==========================================*/
 /* u8x8_display.c */
 uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+uint8_t u8x8_DrawFrame(u8x8_t *u8x8, uint8_t *buf);
 
 /* 
   After a call to u8x8_SetupDefaults, 
@@ -1095,6 +1136,8 @@ const char *u8x8_u8toa(uint8_t v, uint8_t d);
 const char *u8x8_s8toa(int8_t v, uint8_t d);
 const char *u8x8_u16toa(uint16_t v, uint8_t d);
 const char *u8x8_utoa(uint16_t v);
+#define U8X8_FIXED_BUF_LEN 17
+uint8_t u8x8_s32tofixp(char *dest, int32_t v, uint8_t decimals, uint8_t width, char pad);
 
 
 /*==========================================*/
@@ -332,6 +332,49 @@ static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t
 }
 
 
+/*
+  SSD1306 only (the SH1106 has no horizontal addressing mode):
+  The init sequences select the horizontal addressing mode, so after setting
+  column and page range to the full display, all 1024 bytes can be sent as
+  one data stream without the column/page commands of each tile row.
+  SendData is limited to 255 bytes, so the data is sent in steps which are a
+  multiple of the I2C chunk size: the CAD splits each step into full chunks,
+  and only the last transfer of the frame is short (1024 bytes with a chunk
+  of 127: 8 full transfers and one of 8 bytes, with 24: 42 and one of 16).
+  A step which divides the frame instead would end every step with a short
+  transfer unless the chunk divides it too.
+*/
+static void u8x8_d_ssd1306_draw_frame(u8x8_t *u8x8, u8x8_frame_t *frame)
+{
+  uint8_t *ptr = frame->buf_ptr;
+  uint16_t cnt = (uint16_t)u8x8->display_info->tile_width*u8x8->display_info->tile_height*8;
+  uint8_t step = (255/U8X8_I2C_DATA_CHUNK)*U8X8_I2C_DATA_CHUNK;
+  uint8_t x = u8x8->x_offset;
+  
+  if ( step == 0 )
+    step = 255;		/* chunk larger than one SendData */
+  
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_SendCmd(u8x8, 0x020 );	/* horizontal addressing mode */
+  u8x8_cad_SendArg(u8x8, 0x000 );
+  u8x8_cad_SendCmd(u8x8, 0x021 );	/* column range */
+  u8x8_cad_SendArg(u8x8, x );
+  u8x8_cad_SendArg(u8x8, x + u8x8->display_info->pixel_width - 1 );
+  u8x8_cad_SendCmd(u8x8, 0x022 );	/* page range */
+  u8x8_cad_SendArg(u8x8, 0 );
+  u8x8_cad_SendArg(u8x8, u8x8->display_info->tile_height - 1 );
+  while( cnt > step )
+  {
+    u8x8_cad_SendData(u8x8, step, ptr);
+    ptr += step;
+    cnt -= step;
+  }
+  u8x8_cad_SendData(u8x8, cnt, ptr);
+  u8x8_cad_EndTransfer(u8x8);
+  frame->is_done = 1;
+}
+
+
 static const u8x8_display_info_t u8x8_ssd1306_128x64_noname_display_info =
 {
   /* chip_enable_level = */ 0,
@@ -371,6 +414,9 @@ uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
       break;
+    case U8X8_MSG_DISPLAY_DRAW_FRAME:
+      u8x8_d_ssd1306_draw_frame(u8x8, (u8x8_frame_t *)arg_ptr);
+      break;
     default:
       return 0;
   }
@@ -424,6 +470,9 @@ uint8_t u8x8_d_ssd1306_128x64_vcomh0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
       break;
+    case U8X8_MSG_DISPLAY_DRAW_FRAME:
+      u8x8_d_ssd1306_draw_frame(u8x8, (u8x8_frame_t *)arg_ptr);
+      break;
     default:
       return 0;
   }
@@ -445,6 +494,9 @@ uint8_t u8x8_d_ssd1306_128x64_alt0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, v
     case U8X8_MSG_DISPLAY_SETUP_MEMORY:
       u8x8_d_helper_display_setup_memory(u8x8, &u8x8_ssd1306_128x64_noname_display_info);
       break;
+    case U8X8_MSG_DISPLAY_DRAW_FRAME:
+      u8x8_d_ssd1306_draw_frame(u8x8, (u8x8_frame_t *)arg_ptr);
+      break;
     default:
       return 0;
   }
@@ -89,6 +89,19 @@ uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *
   return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, (void *)&tile);
 }
 
+/* 
+  Send the complete display content with one U8X8_MSG_DISPLAY_DRAW_FRAME message.
+  Returns 0 if the display does not support this message, DRAW_TILE must be used instead.
+*/
+uint8_t u8x8_DrawFrame(u8x8_t *u8x8, uint8_t *buf)
+{
+  u8x8_frame_t frame;
+  frame.buf_ptr = buf;
+  frame.is_done = 0;
+  u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_FRAME, 0, (void *)&frame);
+  return frame.is_done;
+}
+
 /* should be implemented as macro */
 void u8x8_SetupMemory(u8x8_t *u8x8)
 {
@@ -74,4 +74,46 @@ const char *u8x8_utoa(uint16_t v)
   if ( *s == '\0' )
     s--;
   return s;
-}
\ No newline at end of file
+}
+
+/*
+  Fixed point to string, without printf and without a static buffer.
+  v is the value multiplied by 10^decimals: v=123, decimals=1 --> "12.3", v=-5, decimals=2 --> "-0.05"
+  With decimals=0 this is a plain signed integer conversion.
+  The result is right aligned to "width" characters with "pad" (' ' or '0'), width=0: no padding.
+  "dest" must have U8X8_FIXED_BUF_LEN bytes (decimals <= 9, width <= U8X8_FIXED_BUF_LEN-1).
+  Returns the length of the string.
+*/
+uint8_t u8x8_s32tofixp(char *dest, int32_t v, uint8_t decimals, uint8_t width, char pad)
+{
+  char digits[12];
+  uint8_t n = 0;
+  uint8_t min_digits = decimals ? decimals + 2 : 1;	/* at least "0.0" */
+  uint8_t len;
+  uint8_t is_neg = v < 0;
+  uint32_t u = is_neg ? -(uint32_t)v : (uint32_t)v;
+  
+  /* digits in reverse order */
+  do
+  {
+    digits[n++] = '0' + u % 10;
+    u /= 10;
+    if ( n == decimals )
+      digits[n++] = '.';
+  } while( u != 0 || n < min_digits );
+  
+  if ( width > U8X8_FIXED_BUF_LEN-1 )
+    width = U8X8_FIXED_BUF_LEN-1;
+  
+  len = 0;
+  if ( is_neg && pad == '0' )
+    dest[len++] = '-';
+  while( len + n + (is_neg && pad != '0') < width )
+    dest[len++] = pad;
+  if ( is_neg && pad != '0' )
+    dest[len++] = '-';
+  while( n > 0 )
+    dest[len++] = digits[--n];
+  dest[len] = '\0';
+  return len;
+}
@@ -1,4 +1,5 @@
 #include <WiFiClient.h>
+#include <lwip/sockets.h>
 #include "ESP32_FTPClient.h"
 
 ESP32_FTPClient::ESP32_FTPClient(char* _serverAdress, uint16_t _port, char* _userName, char* _passWord, uint16_t _timeout, uint8_t _verbose){
@@ -34,58 +35,205 @@ bool ESP32_FTPClient::isConnected(){
   return _isConnected;
 }
 
+// Reuses the logged in control connection, only reconnects when the server
+// closed it or the last command failed
+bool ESP32_FTPClient::EnsureConnection() {
+  if(_isConnected && client.connected())
+    return true;
+
+  FTPdbgn(F("Reconnecting"));
+  client.stop();
+  workDir[0] = 0;
+  OpenConnection();
+  return _isConnected && client.connected();
+}
+
+// Servers drop idle control connections (often after 60-300s), call this
+// regularly between uploads so EnsureConnection() doesn't have to log in again
+void ESP32_FTPClient::KeepAlive(unsigned long idleMs) {
+  if(!_isConnected || !client.connected()) return;
+  if(millis() - lastCommandMs < idleMs) return;
+
+  FTPdbgn("Send NOOP");
+  SendCommand("NOOP");
+  GetFTPAnswer();
+}
+
 void ESP32_FTPClient::GetLastModifiedTime(const char  * fileName, char* result) {
   FTPdbgn("Send MDTM");
   if(!isConnected()) return;
-  client.print(F("MDTM "));
-  client.println(F(fileName));
+  SendCommand("MDTM", fileName);
   GetFTPAnswer (result, 4);
 }
 
-void ESP32_FTPClient::WriteClientBuffered(WiFiClient* cli, unsigned char * data, int dataLength) {
-  if(!isConnected()) return;
+// Writes straight from the caller's buffer (e.g. camera_fb_t::buf) in slices
+// of the TCP send buffer size, no staging copy. Returns the bytes written.
+size_t ESP32_FTPClient::WriteClientBuffered(WiFiClient* cli, const unsigned char * data, size_t dataLength) {
+  if(!isConnected()) return 0;
+
+  size_t written = 0;
+  while(written < dataLength) {
+    size_t slice = dataLength - written;
+    if(slice > bufferSize)
+      slice = bufferSize;
+
+    size_t sent = cli->write(data + written, slice);
+    if(sent == 0) {
+      FTPerr("FTP error: data connection lost\n");
+      break;
+    }
+    written += sent;
+  }
+  return written;
+}
+
+// Sleeps in select() until the socket has data instead of polling available()
+bool ESP32_FTPClient::WaitReadable(WiFiClient& cli, unsigned long ms) {
+  if(cli.available()) return true;
+
+  int fd = cli.fd();
+  if(fd < 0) return false;
 
-  size_t clientCount = 0;
-  for(int i = 0; i < dataLength;i++){
-    clientBuf[clientCount] = data[i];
-    //client.write(data[i])
-    clientCount++;
-    if (clientCount > bufferSize-1) {
-        cli->write(clientBuf, bufferSize); 
-      clientCount = 0;
+  fd_set readSet;
+  FD_ZERO(&readSet);
+  FD_SET(fd, &readSet);
+  struct timeval tv;
+  tv.tv_sec = ms / 1000;
+  tv.tv_usec = (ms % 1000) * 1000;
+  return select(fd + 1, &readSet, NULL, NULL, &tv) > 0;
+}
+
+// Handles one complete line, returns true when it ends a reply.
+// The first line of a reply goes to outBuf, continuation lines are skipped.
+bool ESP32_FTPClient::ReplyLine() {
+  bool hasCode = lineLength >= 3 && isdigit(lineBuf[0]) && isdigit(lineBuf[1]) && isdigit(lineBuf[2]);
+  int code = hasCode ? (lineBuf[0] - '0') * 100 + (lineBuf[1] - '0') * 10 + (lineBuf[2] - '0') : 0;
+
+  if(multiLineCode != 0) {
+    // Only "NNN " with the same code ends it, other lines may start with digits too
+    if(code == multiLineCode && lineBuf[3] == ' ') {
+      multiLineCode = 0;
+      return true;
     }
+    return false;
   }
-  if (clientCount > 0){
-      cli->write(clientBuf, clientCount); 
+
+  if(!hasCode) {
+    FTPdbg(F("Unexpected line: "));
+    FTPdbgn(lineBuf);
+    return false;
   }
+
+  replyCode = code;
+  strncpy(outBuf, lineBuf, sizeof(outBuf) - 1);
+  outBuf[sizeof(outBuf) - 1] = 0;
+
+  if(lineBuf[3] == '-') {
+    multiLineCode = code;
+    return false;
+  }
+  return true;
 }
 
-void ESP32_FTPClient::GetFTPAnswer (char* result, int offsetStart) {
-  char thisByte;
-  outCount = 0;
+// Consumes whatever has arrived without blocking, returns true once a whole
+// reply is in. Bytes after it stay in the socket for the next pipelined reply.
+bool ESP32_FTPClient::PollReply() {
+  while(client.available()) {
+    int c = client.read();
+    if(c < 0) break;
+    if(c == '\r') continue;
+
+    if(c != '\n') {
+      // Long lines are cut, only the code and the first bytes matter
+      if(lineLength < sizeof(lineBuf) - 1)
+        lineBuf[lineLength++] = c;
+      continue;
+    }
 
-  unsigned long _m = millis();
-  while (!client.available() && millis() < _m + timeout) delay(1);
+    lineBuf[lineLength] = 0;
+    bool done = ReplyLine();
+    lineLength = 0;
+    if(done) return true;
+  }
+  return false;
+}
+
+bool ESP32_FTPClient::ReadReply(unsigned long ms) {
+  unsigned long start = millis();
+  for(;;) {
+    if(PollReply()) return true;
+    if(!client.connected() && !client.available()) return false;
+
+    unsigned long elapsed = millis() - start;
+    if(elapsed >= ms || !WaitReadable(client, ms - elapsed)) return false;
+  }
+}
+
+void ESP32_FTPClient::ResetReplies() {
+  lineLength = 0;
+  replyCode = 0;
+  multiLineCode = 0;
+  pendingReplies = 0;
+}
+
+// After a timeout a late reply would be taken for the next command's
+void ESP32_FTPClient::DropSession() {
+  client.stop();
+  ResetReplies();
+  workDir[0] = 0;
+  _isConnected = false;
+}
 
-  if( !client.available()){
+// Reads and drops replies nobody waited for, e.g. after an early return from a pipeline
+void ESP32_FTPClient::DrainReplies() {
+  while(pendingReplies > 0) {
+    if(!ReadReply(timeout)) {
+      DropSession();
+      return;
+    }
+    FTPdbg("Dropped unread reply: ");
+    FTPdbgn(outBuf);
+    pendingReplies--;
+  }
+}
+
+// A 5xx answer to a single command (no such file, directory exists) doesn't
+// end the session, unlike a timeout or a 4xx
+void ESP32_FTPClient::KeepSessionOnError() {
+  if(!_isConnected && replyCode >= 500 && client.connected())
+    _isConnected = true;
+}
+
+// Sends without waiting. Replies still unread from earlier commands are dropped
+// first, unless pipelined is set: then several commands can be sent before
+// reading their replies in order with GetFTPAnswer()
+void ESP32_FTPClient::SendCommand(const char* cmd, const char* arg, bool pipelined) {
+  if(!pipelined) DrainReplies();
+  client.print(cmd);
+  if(arg != NULL && arg[0] != 0) {
+    client.print(' ');
+    client.print(arg);
+  }
+  client.print("\r\n");
+  pendingReplies++;
+}
+
+// Reads the next reply, each one gets its own timeout
+void ESP32_FTPClient::GetFTPAnswer (char* result, int offsetStart) {
+  lastCommandMs = millis();
+
+  if(!ReadReply(timeout)) {
     memset( outBuf, 0, sizeof(outBuf) );
     strcpy( outBuf, "Offline");
 
-    _isConnected = false;
+    DropSession();
     isConnected();
     return;
   }
+  // A 1xx (150 before a transfer) is preliminary, the command's 226 is still to come
+  if(pendingReplies > 0 && replyCode >= 200) pendingReplies--;
 
-  while (client.available()) {
-    thisByte = client.read();
-    if (outCount < sizeof(outBuf)) {
-      outBuf[outCount] = thisByte;
-      outCount++;
-      outBuf[outCount] = 0;
-    }
-  }
-
-  if(outBuf[0] == '4' || outBuf[0] == '5' ){
+  if(replyCode >= 400){
     _isConnected = false;
     isConnected();
     return;
@@ -108,19 +256,38 @@ void ESP32_FTPClient::GetFTPAnswer (char* result, int offsetStart) {
   }
 }
 
-void ESP32_FTPClient::WriteData (unsigned char * data, int dataLength) {
+// False if the data connection broke off, CloseFile() then gets the server's error
+bool ESP32_FTPClient::WriteData (unsigned char * data, int dataLength) {
   FTPdbgn(F("Writing"));
-  if(!isConnected()) return;
-  WriteClientBuffered(&dclient, &data[0], dataLength);
+  if(!isConnected()) return false;
+  return WriteClientBuffered(&dclient, &data[0], dataLength) == (size_t)dataLength;
+}
+
+// Streams whatever the provider hands out until it returns 0, so a file
+// can be uploaded while it is still being produced
+bool ESP32_FTPClient::WriteData (FTPChunkProvider provider, void* arg) {
+  FTPdbgn(F("Writing stream"));
+  if(!isConnected()) return false;
+
+  const unsigned char* chunk;
+  size_t length;
+  while((length = provider(arg, &chunk)) > 0) {
+    if(WriteClientBuffered(&dclient, chunk, length) != length)
+      return false;
+  }
+  return true;
 }
 
-void ESP32_FTPClient::CloseFile () {
+// True only when the server confirms the whole transfer (226/250). A broken
+// transfer is answered with 426/451 and leaves a partial file behind.
+bool ESP32_FTPClient::CloseFile () {
   FTPdbgn(F("Close File"));
   dclient.stop();
   
-  if(!_isConnected) return;
+  if(!_isConnected) return false;
 
   GetFTPAnswer();
+  return _isConnected && (replyCode == 226 || replyCode == 250);
 }
 
 void ESP32_FTPClient::Write(const char * str) {
@@ -131,14 +298,19 @@ void ESP32_FTPClient::Write(const char * str) {
 }
 
 void ESP32_FTPClient::CloseConnection() {
-  client.println(F("QUIT"));
+  SendCommand("QUIT");
   client.stop();
+  ResetReplies();
+  _isConnected = false;
+  workDir[0] = 0;
   FTPdbgn(F("Connection closed"));
 }
 
 void ESP32_FTPClient::OpenConnection() {
   FTPdbg(F("Connecting to: "));
   FTPdbgn(serverAdress);
+  workDir[0] = 0;
+  ResetReplies();
   if( client.connect(serverAdress, port, timeout) )
   {
     FTPdbgn(F("Command connected"));
@@ -148,43 +320,58 @@ void ESP32_FTPClient::OpenConnection() {
 
   /*
   FTPdbgn("Send USER");
-  client.println(F("AUTH TLS"));
+  SendCommand("AUTH TLS");
   GetFTPAnswer();
   */
 
   FTPdbgn("Send USER");
-  client.print(F("USER "));
-  client.println(F(userName));
+  SendCommand("USER", userName);
   GetFTPAnswer();
 
   FTPdbgn("Send PASSWORD");
-  client.print(F("PASS "));
-  client.println(F(passWord));
+  SendCommand("PASS", passWord);
   GetFTPAnswer();
   
   FTPdbgn("Send SYST");
-  client.println(F("SYST"));
+  SendCommand("SYST");
   GetFTPAnswer();
 }
 
-void ESP32_FTPClient::RenameFile(char* from, char* to) {
+bool ESP32_FTPClient::RenameFile(const char* from, const char* to) {
   FTPdbgn("Send RNFR");
-  if(!isConnected()) return;
-  client.print(F("RNFR "));
-  client.println(F(from));
+  if(!isConnected()) return false;
+  SendCommand("RNFR", from);
   GetFTPAnswer();
+  if(replyCode != 350) {
+    KeepSessionOnError();
+    return false;
+  }
 
   FTPdbgn("Send RNTO");
-  client.print(F("RNTO "));
-  client.println(F(to));
+  SendCommand("RNTO", to);
+  GetFTPAnswer();
+  KeepSessionOnError();
+  return replyCode == 250;
+}
+
+// Size in bytes as the server has it, -1 if there is no such file. Needs
+// TYPE I first, servers refuse SIZE in ASCII mode.
+long ESP32_FTPClient::GetFileSize(const char* fileName) {
+  FTPdbgn("Send SIZE");
+  if(!isConnected()) return -1;
+  SendCommand("SIZE", fileName);
   GetFTPAnswer();
+  if(replyCode != 213) {
+    KeepSessionOnError();
+    return -1;
+  }
+  return atol(outBuf + 4);
 }
 
 void ESP32_FTPClient::NewFile (const char* fileName) {
   FTPdbgn("Send STOR");
   if(!isConnected()) return;
-  client.print(F("STOR "));
-  client.println(F(fileName));
+  SendCommand("STOR", fileName);
   GetFTPAnswer();
 }
 
@@ -192,12 +379,21 @@ void ESP32_FTPClient::InitFile(const char* type){
   FTPdbgn("Send TYPE");
   if(!isConnected()) return;
   FTPdbgn(type);
-  client.println(F(type));
-  GetFTPAnswer();
+  SendCommand(type);
 
+  // Pipelined, both replies come back in one round trip
   FTPdbgn("Send PASV");
-  client.println(F("PASV"));
+  SendCommand("PASV", NULL, true);
+
+  GetFTPAnswer();
+  bool typeOk = _isConnected;
   GetFTPAnswer();
+  if(!typeOk) {
+    // The PASV reply was read anyway so the next command lines up with its own
+    _isConnected = false;
+    return;
+  }
+  if(!_isConnected) return;
 
   char *tStr = strtok(outBuf, "(,");
   int array_pasv[6];
@@ -224,36 +420,66 @@ void ESP32_FTPClient::InitFile(const char* type){
   }
 }
 
-void ESP32_FTPClient::AppendFile (char* fileName) {
+void ESP32_FTPClient::AppendFile (const char* fileName) {
   FTPdbgn("Send APPE");
   if(!isConnected()) return;
-  client.print(F("APPE "));
-  client.println(F(fileName));
+  SendCommand("APPE", fileName);
   GetFTPAnswer();
 }
 
+// Continues fileName from offset, the data written next has to start there.
+// REST before STOR where the server has it, otherwise APPE, which continues at the
+// end - the same place as long as offset came from GetFileSize().
+bool ESP32_FTPClient::ResumeFile(const char* fileName, size_t offset) {
+  FTPdbgn("Send REST");
+  if(!isConnected()) return false;
+  char position[12];
+  snprintf(position, sizeof(position), "%lu", (unsigned long)offset);
+  SendCommand("REST", position);
+  GetFTPAnswer();
+
+  if(replyCode == 350) {
+    NewFile(fileName);
+  } else {
+    KeepSessionOnError();
+    AppendFile(fileName);
+  }
+  return _isConnected;
+}
+
 void ESP32_FTPClient::ChangeWorkDir(const char * dir) {
+  // Still there from the last call on this connection
+  if(_isConnected && client.connected() && strcmp(dir, workDir) == 0) return;
+
   FTPdbgn("Send CWD");
   if(!isConnected()) return;
-  client.print(F("CWD "));
-  client.println(F(dir));
+  SendCommand("CWD", dir);
   GetFTPAnswer();
+
+  // Repeating the same CWD is skipped, so a relative path isn't entered twice
+  if(_isConnected && strlen(dir) < sizeof(workDir))
+    strcpy(workDir, dir);
+  else
+    workDir[0] = 0;
 }
 
 void ESP32_FTPClient::DeleteFile(const char * file) {
   FTPdbgn("Send DELE");
   if(!isConnected()) return;
-  client.print(F("DELE "));
-  client.println(F(file));
+  SendCommand("DELE", file);
   GetFTPAnswer();
 }
 
-void ESP32_FTPClient::MakeDir(const char * dir) {
+// False only when the session is gone. Servers answer 550 (some 521) when the
+// directory exists already, that doesn't end the session like other errors.
+bool ESP32_FTPClient::MakeDir(const char * dir) {
   FTPdbgn("Send MKD");
-  if(!isConnected()) return;
-  client.print(F("MKD "));
-  client.println(F(dir));
+  if(!isConnected()) return false;
+  SendCommand("MKD", dir);
   GetFTPAnswer();
+
+  KeepSessionOnError();
+  return _isConnected;
 }
 
 void ESP32_FTPClient::ContentList(const char * dir, String * list) {
@@ -262,8 +488,7 @@ void ESP32_FTPClient::ContentList(const char * dir, String * list) {
   
   FTPdbgn("Send MLSD");
   if(!isConnected()) return;
-  client.print(F("MLSD"));
-  client.println(F(dir));
+  SendCommand("MLSD", dir);
   GetFTPAnswer(_resp);
 
   // Convert char array to string to manipulate and find response size
@@ -272,8 +497,7 @@ void ESP32_FTPClient::ContentList(const char * dir, String * list) {
   //resp_string.substring(resp_string.lastIndexOf('matches')-9);
   //FTPdbgn(resp_string);
   
-  unsigned long _m = millis();
-  while( !dclient.available() && millis() < _m + timeout) delay(1);
+  WaitReadable(dclient, timeout);
 
   while(dclient.available()) 
   {
@@ -285,6 +509,8 @@ void ESP32_FTPClient::ContentList(const char * dir, String * list) {
     }
   }
 
+  // The 226 stays pending, the next command reads and drops it
+  dclient.stop();
 }
 
 void ESP32_FTPClient::ContentListWithListCommand(const char * dir, String * list) {
@@ -293,8 +519,7 @@ void ESP32_FTPClient::ContentListWithListCommand(const char * dir, String * list
   
   FTPdbgn("Send LIST");
   if(!isConnected()) return;
-  client.print(F("LIST"));
-  client.println(F(dir));
+  SendCommand("LIST", dir);
   GetFTPAnswer(_resp);
 
   // Convert char array to string to manipulate and find response size
@@ -303,8 +528,7 @@ void ESP32_FTPClient::ContentListWithListCommand(const char * dir, String * list
   //resp_string.substring(resp_string.lastIndexOf('matches')-9);
   //FTPdbgn(resp_string);
   
-  unsigned long _m = millis();
-  while( !dclient.available() && millis() < _m + timeout) delay(1);
+  WaitReadable(dclient, timeout);
 
   while(dclient.available()) 
   {
@@ -317,40 +541,38 @@ void ESP32_FTPClient::ContentListWithListCommand(const char * dir, String * list
     }
   }
 
+  dclient.stop();
 }
 
 void ESP32_FTPClient::DownloadString(const char * filename, String &str) {
   FTPdbgn("Send RETR");
   if(!isConnected()) return;
-  client.print(F("RETR "));
-  client.println(F(filename));
+  SendCommand("RETR", filename);
 
   char _resp[ sizeof(outBuf) ];
   GetFTPAnswer(_resp);
 
-  unsigned long _m = millis();
-  while( !GetDataClient()->available() && millis() < _m + timeout) delay(1);
+  WaitReadable(*GetDataClient(), timeout);
   
   while( GetDataClient()->available() )
   {
     str += GetDataClient()->readString();
   }
 
+  dclient.stop();
 }
 
 void ESP32_FTPClient::DownloadFile(const char * filename, unsigned char * buf, size_t length, bool printUART ) {
   FTPdbgn("Send RETR");
   if(!isConnected()) return;
-  client.print(F("RETR "));
-  client.println(F(filename));
+  SendCommand("RETR", filename);
   
   char _resp[ sizeof(outBuf) ];    
   GetFTPAnswer(_resp);
 
   char _buf[2];
 
-  unsigned long _m = millis();
-  while( !dclient.available() && millis() < _m + timeout) delay(1);
+  WaitReadable(dclient, timeout);
 
   while(dclient.available()) 
   {
@@ -366,4 +588,6 @@ void ESP32_FTPClient::DownloadFile(const char * filename, unsigned char * buf, s
       }
     }
   }
+
+  dclient.stop();
 }
@@ -1,9 +1,17 @@
+// lwIP's default TCP send buffer (4 * MSS), larger writes only wait for ACKs in between
+#ifndef FTP_WRITE_CHUNK
+#define FTP_WRITE_CHUNK 5744
+#endif
+
+// Supplies upload data piece by piece, e.g. from a JPEG encoder.
+// Points *chunk at the next piece and returns its length, 0 at the end.
+typedef size_t (*FTPChunkProvider)(void* arg, const unsigned char** chunk);
+
 class ESP32_FTPClient
 {
   private:
-  void WriteClientBuffered(WiFiClient* cli, unsigned char * data, int dataLength);
+  size_t WriteClientBuffered(WiFiClient* cli, const unsigned char * data, size_t dataLength);
   char outBuf[128];
-  unsigned char outCount;
   WiFiClient client;
   WiFiClient dclient;
   uint8_t verbose;
@@ -28,10 +36,26 @@ class ESP32_FTPClient
   char* serverAdress;
   uint16_t port;
   bool _isConnected = false;
-  unsigned char clientBuf[1500];
-  size_t bufferSize = 1500;
+  size_t bufferSize = FTP_WRITE_CHUNK;
   uint16_t timeout = 10000;
+  // Session state, so a long running client can keep the login and CWD between uploads
+  unsigned long lastCommandMs = 0;
+  char workDir[64] = "";
+  // Reply parser state, a reply can arrive in pieces or several at once when commands are pipelined
+  char lineBuf[128];
+  uint8_t lineLength = 0;
+  int replyCode = 0;
+  int multiLineCode = 0;     // Code of the multi-line reply being read ("NNN-" ... "NNN "), 0 if none
+  uint8_t pendingReplies = 0;  // Commands sent whose reply hasn't been read yet
   WiFiClient* GetDataClient();
+  bool WaitReadable(WiFiClient& cli, unsigned long ms);
+  bool ReplyLine();
+  bool PollReply();
+  bool ReadReply(unsigned long ms);
+  void ResetReplies();
+  void DropSession();
+  void DrainReplies();
+  void KeepSessionOnError();
   
   public:
   ESP32_FTPClient(char* _serverAdress, uint16_t _port, char* _userName, char* _passWord, uint16_t _timeout = 10000, uint8_t _verbose = 1);
@@ -39,18 +63,25 @@ class ESP32_FTPClient
   void OpenConnection();
   void CloseConnection();
   bool isConnected();
+  bool EnsureConnection();
+  void KeepAlive(unsigned long idleMs = 30000);
   void NewFile (const char* fileName);
-  void AppendFile( char* fileName);
-  void WriteData (unsigned char * data, int dataLength);
-  void CloseFile ();
+  void AppendFile(const char* fileName);
+  bool ResumeFile(const char* fileName, size_t offset);
+  bool WriteData (unsigned char * data, int dataLength);
+  bool WriteData (FTPChunkProvider provider, void* arg = NULL);
+  bool CloseFile ();
+  void SendCommand(const char* cmd, const char* arg = NULL, bool pipelined = false);
   void GetFTPAnswer (char* result = NULL, int offsetStart = 0);
+  int GetReplyCode() { return replyCode; }
   void GetLastModifiedTime(const char* fileName, char* result);
-  void RenameFile(char* from, char* to);
+  bool RenameFile(const char* from, const char* to);
+  long GetFileSize(const char* fileName);
   void Write(const char * str);
   void InitFile(const char* type);
   void ChangeWorkDir(const char * dir);
   void DeleteFile(const char * file);
-  void MakeDir(const char * dir);
+  bool MakeDir(const char * dir);
   void ContentList(const char * dir, String * list);
   void ContentListWithListCommand(const char * dir, String * list);
   void DownloadString(const char * filename, String &str);